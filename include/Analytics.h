@@ -25,7 +25,7 @@ private:
     int hashFunction(int key) const {
         return key % MAP_SIZE;
     }
-    
+
 public:
     ManualHashMap() {
         for (int i = 0; i < MAP_SIZE; i++) {
@@ -122,17 +122,18 @@ private:
     void sortPairsDescending(vector<pair<int, int>>& pairs);
     void sortRoutesByPassengers(vector<RouteMetadata>& routes);
     void sortDensityData(vector<pair<int, int>>& data);
-    
+
 public:
     Analytics(Graph* g, HashTable* h, BST* b, Heap* hp);
     
-    // Analytics functions
-    void mostCrowdedStation();
-    void busiestRoute();
-    void fastestVehicleAssignment();
-    void trafficDensityPrediction();
-    void dailyUsageTrends();
-    void generateReport();
+    // Analytics functions - each report is written to out and flushed once at the end
+    void mostCrowdedStation(ostream& out = cout);
+    void busiestRoute(ostream& out = cout);
+    void fastestVehicleAssignment(ostream& out = cout);
+    void trafficDensityPrediction(ostream& out = cout);
+    void dailyUsageTrends(ostream& out = cout);
+    void criticalStations(ostream& out = cout, int samples = -1);  // -1: exact up to 1000 stations, else 256 sampled sources
+    void generateReport(ostream& out = cout);
     
     // Helper functions
     void updateStationFrequency(int stationId);
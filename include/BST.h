@@ -53,6 +53,7 @@ private:
     void preorderHelper(BSTNode* node, vector<RouteMetadata>& result);
     void postorderHelper(BSTNode* node, vector<RouteMetadata>& result);
     void clearHelper(BSTNode* node);
+    BSTNode* buildBalanced(const vector<RouteMetadata>& sorted, int low, int high);
     
 public:
     BST();
@@ -60,6 +61,11 @@ public:
     
     // BST operations
     void insert(RouteMetadata data);
+    // Bulk insert without output; later records win over earlier ones and over
+    // existing routes with the same ID. Merges with the in-order contents and
+    // rebuilds a balanced tree (small batches into a large tree are inserted one
+    // by one). Returns the number of new routes - Time: O(n + batch log batch)
+    int insertBatch(const vector<RouteMetadata>& routes);
     RouteMetadata* search(int routeId);
     bool remove(int routeId);
     void displayInorder();
@@ -0,0 +1,116 @@
+#ifndef BULKLOADER_H
+#define BULKLOADER_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "HashTable.h"
+#include "BST.h"
+#include "Queue.h"
+
+using namespace std;
+
+// Streaming CSV reader: the file is read with fread() in large chunks and every
+// record is split in place inside the buffer, so no per-line allocation and no
+// iostream parsing is involved.
+//
+// One record per line, comma-separated. A field may be quoted ("..." with ""
+// for a literal quote) but may not span lines. Spaces around unquoted fields,
+// blank lines and a trailing \r (Windows files) are ignored. A line longer than
+// the buffer grows it.
+class CsvReader {
+private:
+    FILE* file;
+    vector<char> buffer;    // One spare byte past the data always holds '\0'
+    size_t begin;           // First unread byte
+    size_t end;             // End of the data read so far
+    bool atEnd;             // fread() has hit the end of the file
+    long long lineNumber;
+    long long recordNumber; // Non-blank lines returned so far
+    long long bytesRead;
+    vector<const char*> fieldStart;  // Point into buffer until the next next()
+    vector<int> fieldLength;
+    vector<char> fieldQuoted;
+    
+    bool refill();          // Moves the unread tail to the front and reads more
+    void splitFields(const char* line, const char* lineEnd);
+
+public:
+    explicit CsvReader(size_t bufferSize = 1 << 20);
+    ~CsvReader();
+    
+    // Owns the FILE, so the object must not be copied
+    CsvReader(const CsvReader&) = delete;
+    CsvReader& operator=(const CsvReader&) = delete;
+    
+    bool open(const string& filename);
+    void close();
+    bool isOpen() const { return file != nullptr; }
+    
+    bool next();            // Advances to the next non-blank record; false at end of file
+    int getFieldCount() const { return fieldStart.size(); }
+    long long getLineNumber() const { return lineNumber; }
+    long long getRecordNumber() const { return recordNumber; }
+    long long getBytesRead() const { return bytesRead; }
+    
+    // False if the field is missing or is not exactly one number
+    bool getInt(int field, int& value) const;
+    bool getDouble(int field, double& value) const;
+    string getString(int field) const;  // Quotes removed, "" unescaped; empty if missing
+    
+    // Parsers for a field of known length (no terminator needed)
+    static bool parseInt(const char* text, int length, int& value);
+    static bool parseDouble(const char* text, int length, double& value);
+};
+
+// Result of one load
+struct LoadStats {
+    long long records;      // Well-formed records
+    long long rejected;     // Malformed lines, skipped
+    long long skipped;      // Well-formed records the target refused (duplicate station, unknown station)
+    long long firstRejectedLine;  // 0 if none
+    long long bytes;
+    double elapsedMs;
+    LoadStats() : records(0), rejected(0), skipped(0), firstRejectedLine(0), bytes(0), elapsedMs(0.0) {}
+    double recordsPerSecond() const {
+        return elapsedMs > 0.0 ? records * 1000.0 / elapsedMs : 0.0;
+    }
+};
+
+// Bulk import of CSV files through the batch APIs (Graph::addStations,
+// Graph::addRoutes, HashTable::insertBatch, BST::insertBatch,
+// Queue::enqueueBatch). Records are parsed into a batch of batchSize and
+// handed over when it is full, so memory stays bounded for any file size.
+//
+// File formats (a header line is optional and recognised by a non-numeric
+// first field):
+//   stations:       id,name[,x,y]
+//   routes:         source,destination,weight      (stations must exist)
+//   vehicles:       id,type,model,capacity,speed
+//   route metadata: routeId,routeName[,passengerCount,averageTime]
+//   passengers:     id,name,sourceStation,destinationStation
+// Malformed lines are counted in LoadStats and skipped without output. Each
+// load returns false only if the file cannot be opened.
+class BulkLoader {
+private:
+    size_t bufferSize;
+    int batchSize;
+    
+    static void reject(const CsvReader& reader, LoadStats& stats);
+    static bool skipHeaderOrReject(const CsvReader& reader, LoadStats& stats);
+
+public:
+    explicit BulkLoader(size_t bufferSize = 1 << 20, int batchSize = 65536);
+    
+    bool loadStations(const string& filename, Graph& graph, LoadStats* stats = nullptr);
+    bool loadRoutes(const string& filename, Graph& graph, LoadStats* stats = nullptr);
+    bool loadVehicles(const string& filename, HashTable& vehicles, LoadStats* stats = nullptr);
+    bool loadRouteMetadata(const string& filename, BST& routes, LoadStats* stats = nullptr);
+    bool loadPassengers(const string& filename, Queue& passengers, LoadStats* stats = nullptr);
+    
+    // One summary line: counts, time and records per second
+    static void printStats(const string& what, const LoadStats& stats);
+};
+
+#endif
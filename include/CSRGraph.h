@@ -0,0 +1,60 @@
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include <vector>
+#include <climits>
+#include "Heap.h"
+
+using namespace std;
+
+// Immutable compressed sparse row (CSR) snapshot of a Graph.
+// The outgoing edges of vertex v are stored contiguously in
+// targets/weights[offsets[v] .. offsets[v+1]), in the same order as the
+// adjacency list they were copied from, so every traversal visits
+// neighbours in the same order as the Graph version.
+// Built with Graph::freeze(); later changes to the Graph are not reflected.
+class CSRGraph {
+private:
+    int numVertices;
+    vector<int> offsets;  // Size V+1, edge range of each vertex
+    vector<int> targets;  // Size E, destination of each edge
+    vector<int> weights;  // Size E, weight of each edge
+    
+    friend class Graph;  // Graph::freeze() fills the arrays
+
+public:
+    CSRGraph();
+    
+    // Read-only graph algorithms (same results as the Graph versions)
+    vector<int> BFS(int startVertex) const;
+    vector<int> DFS(int startVertex) const;
+    vector<int> shortestPath(int src, int dest, int* distance = nullptr) const; // Dijkstra's algorithm
+    vector<pair<pair<int, int>, int>> minimumSpanningTree() const; // Kruskal's algorithm
+    bool detectCycle() const;
+    
+    // Dijkstra over raw CSR arrays; shared with MappedGraph, which serves the
+    // same arrays from a file mapping
+    static vector<int> dijkstra(const int* offsets, const int* targets, const int* weights,
+                                int numVertices, int src, int dest, int* distance);
+    // Follows parent links back from dest (-1 ends the chain); path in travel order
+    static vector<int> buildPath(const vector<int>& parent, int dest);
+    
+    // Kruskal over collected {weight, {u, v}} edges, shared with Graph; the MST
+    // comes back in weight order, equal weights in collection order
+    static vector<pair<pair<int, int>, int>> kruskal(vector<pair<int, pair<int, int>>>& edges, int numVertices);
+    static void sortEdges(vector<pair<int, pair<int, int>>>& edges);  // Stable LSD radix sort on weight
+    // Union-find with iterative path compression and union by rank
+    static int findParent(vector<int>& parent, int i);
+    static void unionSets(vector<int>& parent, vector<int>& rank, int x, int y);
+    
+    // Raw access to the packed arrays
+    int getNumVertices() const { return numVertices; }
+    int getNumEdges() const { return targets.size(); }
+    int edgeBegin(int v) const { return offsets[v]; }
+    int edgeEnd(int v) const { return offsets[v + 1]; }
+    int edgeTarget(int e) const { return targets[e]; }
+    int edgeWeight(int e) const { return weights[e]; }
+    int degree(int v) const { return offsets[v + 1] - offsets[v]; }
+};
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef CONTRACTIONHIERARCHY_H
+#define CONTRACTIONHIERARCHY_H
+
+#include <vector>
+#include <string>
+#include <climits>
+#include "Graph.h"
+#include "Heap.h"
+
+using namespace std;
+
+// Edge of the hierarchy; middle is the contracted vertex a shortcut bypasses
+// (-1 for an original route)
+struct CHEdge {
+    int target;
+    int weight;
+    int middle;
+    CHEdge(int t, int w, int m) : target(t), weight(w), middle(m) {}
+};
+
+// Scratch space for the witness searches run during preprocessing
+struct WitnessWorkspace {
+    vector<int> dist;        // INT_MAX when untouched
+    vector<int> touched;     // Vertices whose dist must be reset
+    vector<int> targetMark;  // == stamp for out-neighbours still to be settled
+    int stamp;
+    IndexedMinHeap queue;
+    WitnessWorkspace(int n) : dist(n, INT_MAX), targetMark(n, -1), stamp(0), queue(n) {}
+};
+
+// Contraction Hierarchies for fast point-to-point queries
+//
+// build() contracts vertices one at a time in order of importance (edge
+// difference, contracted neighbours and level, lazily re-evaluated) and adds a
+// shortcut u->w whenever the path u->v->w through the contracted vertex v
+// is the only shortest one (checked with a bounded witness search).
+// Queries run a bidirectional Dijkstra that only climbs to higher-ranked
+// vertices, then unpack shortcuts back into original routes.
+//
+// Both the upward and the (reversed) downward graph are stored in CSR form
+// and can be saved to / loaded from a compact binary file.
+// Queries reuse internal workspaces, so one instance must not be queried
+// from several threads at once.
+class ContractionHierarchy {
+private:
+    int numVertices;
+    int numShortcuts;
+    vector<int> rank;  // Contraction position of each vertex
+    
+    // Upward edges u->v with rank[v] > rank[u], stored at u
+    vector<int> upOffsets, upTargets, upWeights, upMiddle;
+    // Downward edges v->u with rank[v] > rank[u], stored reversed at u (target = v)
+    vector<int> downOffsets, downTargets, downWeights, downMiddle;
+    
+    // Query workspaces (reset through touched lists, not O(V) clears)
+    mutable vector<int> forwardDist, backwardDist;
+    mutable vector<int> forwardParent, backwardParent;
+    mutable vector<int> forwardParentEdge, backwardParentEdge;
+    mutable vector<int> touched;
+    mutable IndexedMinHeap forwardQueue, backwardQueue;
+    
+    // Preprocessing helpers
+    void addOrUpdateEdge(vector<vector<CHEdge>>& outEdges, vector<vector<CHEdge>>& inEdges,
+                         int from, int to, int weight, int middle);
+    int contractVertex(int v, vector<vector<CHEdge>>& outEdges, vector<vector<CHEdge>>& inEdges,
+                       const vector<bool>& contracted, bool simulate, WitnessWorkspace& witness);
+    void packEdges(const vector<vector<CHEdge>>& lists, vector<int>& offsets, vector<int>& targets,
+                   vector<int>& weights, vector<int>& middles);
+    void prepareWorkspace() const;
+    
+    // Query helpers
+    int search(int src, int dest, int& meet) const;
+    void unpackEdge(int from, int to, int middle, vector<int>& path) const;
+    int findEdge(const vector<int>& offsets, const vector<int>& targets, int at, int target) const;
+    
+    // Load helpers
+    bool checkStructure() const;  // Every index and shortcut the queries will follow
+    bool checkEdges(const vector<int>& offsets, const vector<int>& targets, const vector<int>& middles,
+                    bool upward) const;
+
+public:
+    ContractionHierarchy();
+    
+    // Preprocessing - offline, Time: roughly O(V * witness search)
+    void build(const Graph& graph);
+    
+    // Queries - same distances as Graph::shortestPath
+    int distance(int src, int dest) const;  // INT_MAX if unreachable
+    vector<int> shortestPath(int src, int dest, int* distance = nullptr) const;
+    
+    // Compact binary serialization
+    bool save(const string& filename) const;
+    bool load(const string& filename);
+    
+    int getNumVertices() const { return numVertices; }
+    int getNumShortcuts() const { return numShortcuts; }
+    int getNumEdges() const { return upTargets.size() + downTargets.size(); }
+};
+
+#endif
@@ -4,6 +4,9 @@
 #include <vector>
 #include <string>
 #include <climits>
+#include "Heap.h"
+#include "CSRGraph.h"
+#include "TimeProfile.h"
 
 using namespace std;
 
@@ -11,41 +14,100 @@ using namespace std;
 struct Edge {
     int destination;
     int weight;
-    Edge* next;  // For manual linked list
-    Edge(int dest, int w) : destination(dest), weight(w), next(nullptr) {}
+    int profile;  // Travel-time profile ID in the Graph's store, -1 = static weight
+    Edge* next;   // For manual linked list
+    Edge() : destination(-1), weight(0), profile(-1), next(nullptr) {}
+    Edge(int dest, int w) : destination(dest), weight(w), profile(-1), next(nullptr) {}
+};
+
+// Slab allocator for Edge nodes (owned by Graph)
+// Nodes are handed out from contiguous blocks and recycled through a free list,
+// so loading routes does not pay for one heap allocation per edge.
+class EdgePool {
+private:
+    static const int BLOCK_SIZE = 4096;
+    vector<Edge*> blocks;
+    Edge* freeList;    // Released nodes, linked through Edge::next
+    int usedInBlock;   // Nodes handed out from the newest block
+    int liveCount;
+
+public:
+    EdgePool() : freeList(nullptr), usedInBlock(BLOCK_SIZE), liveCount(0) {}
+    
+    ~EdgePool() {
+        for (size_t i = 0; i < blocks.size(); i++) {
+            delete[] blocks[i];
+        }
+    }
+    
+    // Pool owns raw memory, so it must not be copied
+    EdgePool(const EdgePool&) = delete;
+    EdgePool& operator=(const EdgePool&) = delete;
+    
+    // Allocate - Time: O(1) amortized, Space: O(1)
+    Edge* allocate(int dest, int weight) {
+        Edge* node;
+        if (freeList != nullptr) {
+            node = freeList;
+            freeList = freeList->next;
+        } else {
+            if (usedInBlock == BLOCK_SIZE) {
+                blocks.push_back(new Edge[BLOCK_SIZE]);
+                usedInBlock = 0;
+            }
+            node = &blocks.back()[usedInBlock++];
+        }
+        node->destination = dest;
+        node->weight = weight;
+        node->profile = -1;
+        node->next = nullptr;
+        liveCount++;
+        return node;
+    }
+    
+    // Release - Time: O(1), Space: O(1)
+    void release(Edge* node) {
+        node->next = freeList;
+        freeList = node;
+        liveCount--;
+    }
+    
+    int getLiveCount() const { return liveCount; }
+    int getCapacity() const { return blocks.size() * BLOCK_SIZE; }
 };
 
 // Manual linked list for edges (adjacency list)
+// Nodes come from the owning Graph's EdgePool; the list only links them,
+// so copying an EdgeList (e.g. when adjList grows) never frees nodes.
 class EdgeList {
 private:
     Edge* head;
-    
+    Edge* tail;
+    int count;
+
 public:
-    EdgeList() : head(nullptr) {}
+    EdgeList() : head(nullptr), tail(nullptr), count(0) {}
     
-    ~EdgeList() {
-        clear();
-    }
-    
-    void push_back(int dest, int weight) {
-        Edge* newNode = new Edge(dest, weight);
+    // Append - Time: O(1), Space: O(1)
+    void push_back(EdgePool& pool, int dest, int weight) {
+        Edge* newNode = pool.allocate(dest, weight);
         if (head == nullptr) {
-            head = newNode;
+            head = tail = newNode;
         } else {
-            Edge* current = head;
-            while (current->next != nullptr) {
-                current = current->next;
-            }
-            current->next = newNode;
+            tail->next = newNode;
+            tail = newNode;
         }
+        count++;
     }
     
-    void clear() {
+    void clear(EdgePool& pool) {
         while (head != nullptr) {
             Edge* temp = head;
             head = head->next;
-            delete temp;
+            pool.release(temp);
         }
+        tail = nullptr;
+        count = 0;
     }
     
     bool empty() const {
@@ -56,67 +118,115 @@ public:
     Edge* begin() const { return head; }
     Edge* end() const { return nullptr; }
     
-    // Remove edge with specific destination
-    void remove(int dest) {
-        if (head == nullptr) return;
-        
-        // If head needs to be removed
-        if (head->destination == dest) {
-            Edge* temp = head;
-            head = head->next;
-            delete temp;
-            return;
-        }
-        
-        // Find and remove
+    // Remove edge with specific destination - Time: O(degree), Space: O(1)
+    void remove(EdgePool& pool, int dest) {
+        Edge* previous = nullptr;
         Edge* current = head;
-        while (current->next != nullptr) {
-            if (current->next->destination == dest) {
-                Edge* temp = current->next;
-                current->next = current->next->next;
-                delete temp;
+        while (current != nullptr) {
+            if (current->destination == dest) {
+                if (previous == nullptr) {
+                    head = current->next;
+                } else {
+                    previous->next = current->next;
+                }
+                if (current == tail) {
+                    tail = previous;
+                }
+                pool.release(current);
+                count--;
                 return;
             }
+            previous = current;
             current = current->next;
         }
     }
     
-    // Get size
+    // Get size - Time: O(1)
     int size() const {
-        int count = 0;
-        Edge* current = head;
-        while (current != nullptr) {
-            count++;
-            current = current->next;
-        }
         return count;
     }
 };
 
 // Structure to represent a station
+// Coordinates are optional: planar (x, y) or (latitude, longitude) in degrees,
+// depending on the heuristic that reads them.
 struct Station {
     int id;
     string name;
-    Station(int i, string n) : id(i), name(n) {}
+    double x;
+    double y;
+    bool hasCoordinates;
+    Station(int i, string n) : id(i), name(n), x(0.0), y(0.0), hasCoordinates(false) {}
+    Station(int i, string n, double px, double py)
+        : id(i), name(n), x(px), y(py), hasCoordinates(true) {}
+};
+
+// One route of a bulk load (Graph::addRoutes)
+struct RouteRecord {
+    int src;
+    int dest;
+    int weight;
+    RouteRecord(int s, int d, int w) : src(s), dest(d), weight(w) {}
+};
+
+// Work counters for a single point-to-point search
+struct SearchStats {
+    int settledNodes;  // Vertices removed from the priority queue
+    int distance;      // INT_MAX when dest is unreachable
+    double elapsedMs;
+    SearchStats() : settledNodes(0), distance(INT_MAX), elapsedMs(0.0) {}
+};
+
+// Shortest path tree of a hub station, kept current as routes change
+struct HubTree {
+    int hub;
+    vector<int> dist;    // INT_MAX if unreachable
+    vector<int> parent;  // Previous station on the tree path, -1 for the hub and unreachable ones
 };
 
+class Heuristic;
+
 // Graph class using adjacency list representation
+// Vertices are station IDs, so memory is O(max station ID + E): the adjacency
+// lists, the station index and the search workspaces all have one entry per
+// ID up to the largest one, and IDs should be kept dense. IDs above
+// MAX_STATION_ID are rejected. Edge weights are looked up through the lists.
 class Graph {
 private:
     int numVertices;
-    vector<EdgeList> adjList;  // Manual linked list instead of std::list
+    EdgePool edgePool;                // Owns every Edge node in adjList
+    vector<EdgeList> adjList;         // Manual linked list instead of std::list
+    EdgePool reverseEdgePool;         // Owns every Edge node in reverseAdjList
+    vector<EdgeList> reverseAdjList;  // Incoming routes: destination = source station
     vector<Station> stations;
-    vector<vector<int>> adjMatrix; // For MST and some algorithms
+    vector<int> stationIndex;  // stationIndex[id] = slot in stations, -1 if none
+    TravelTimeProfiles profiles;  // Shared time-of-day curves referenced by Edge::profile
+    
+    // Dynamic shortest path trees of selected hubs, repaired on every route change
+    vector<HubTree> hubTrees;
+    vector<int> repairMark;       // == repairStamp for stations in the subtree being repaired
+    int repairStamp;
+    IndexedMinHeap repairQueue;
+    vector<int> repairList;
+    int lastRepairCount;          // Stations whose label was recomputed by the last change
+    
+    // Helper for O(1) station lookup
+    int findStationSlot(int id) const;
     
-    // Helper function for DFS
-    void DFSUtil(int v, vector<bool>& visited, vector<int>& result);
+    // Reusable DFS workspace: a station is visited in the current traversal when
+    // mark >= stamp (stamp + 1 while it is still on the stack), so starting a new
+    // traversal only bumps the stamp instead of clearing the marks
+    vector<int> visitMark;
+    int visitStamp;
+    vector<int> stackVertex;
+    vector<Edge*> stackEdge;   // Next route to try from the station at the same depth
+    void beginTraversal();
     
-    // Helper function for cycle detection
-    bool hasCycleUtil(int v, vector<bool>& visited, vector<bool>& recStack);
+    // Helper function for DFS (explicit stack, same order as the recursive version)
+    void DFSUtil(int v, vector<int>& result);
     
-    // Helper function for MST (Kruskal's algorithm)
-    int findParent(vector<int>& parent, int i);
-    void unionSets(vector<int>& parent, vector<int>& rank, int x, int y);
+    // Helper function for cycle detection (explicit stack)
+    bool hasCycleUtil(int v);
     
     // Manual queue implementation for BFS (no external libraries)
     struct QueueNode {
@@ -157,21 +267,47 @@ private:
         bool isEmpty() const { return front == nullptr; }
     };
     
-    // Manual sorting for MST (bubble sort - simple and manual)
-    void sortEdges(vector<pair<int, pair<int, int>>>& edges);
+    // Helpers for the dynamic hub trees
+    void buildHubTree(HubTree& tree);
+    void prepareRepair();
+    void onRouteChanged(int src, int dest, int oldWeight, int newWeight); // -1 = no route
+    void repairDecrease(HubTree& tree, int src, int dest, int weight);
+    void repairIncrease(HubTree& tree, int src, int dest);
+    
+    // Helper for freeze/freezeReverse
+    CSRGraph packLists(const vector<EdgeList>& lists) const;
 
 public:
-    Graph(int V = 0);
+    // Largest accepted station ID; caps the per-ID arrays at a few hundred MB
+    static const int MAX_STATION_ID = (1 << 24) - 1;
+    
+    Graph(int V = 0);  // V is clamped to [0, MAX_STATION_ID + 1]
     
     // Station management
     void addStation(int id, const string& name);
+    void addStation(int id, const string& name, double x, double y);
     void deleteStation(int id);
     Station* getStation(int id);
+    // Bulk insert without per-record output; negative, too large and duplicate
+    // IDs are skipped. Returns the number added - Time: O(batch + max ID)
+    int addStations(const vector<Station>& batch);
     vector<Station> getAllStations() const;
     
     // Route management
     void addRoute(int src, int dest, int weight);
+    // Bulk insert without per-record output; routes to or from IDs without a
+    // station are skipped, existing ones get the new weight and hub trees are
+    // rebuilt once at the end. Returns the number added or updated - Time: O(sum of out-degrees touched)
+    int addRoutes(const vector<RouteRecord>& batch);
     void deleteRoute(int src, int dest);
+    int getRouteWeight(int src, int dest) const; // -1 if no such route
+    
+    // Time-dependent travel times (see TravelTimeProfiles); the static weight
+    // is kept and still used by every algorithm except shortestPathAt
+    int addTravelTimeProfile(const vector<int>& times, const vector<int>& travelTimes); // -1 if invalid
+    bool setRouteProfile(int src, int dest, int profileId); // profileId -1 restores the static weight
+    int getRouteTravelTime(int src, int dest, int departureTime) const; // -1 if no such route
+    const TravelTimeProfiles& getProfiles() const { return profiles; }
     
     // Graph operations
     void displayAllStations();
@@ -180,12 +316,65 @@ public:
     // Graph algorithms
     vector<int> BFS(int startVertex);
     vector<int> DFS(int startVertex);
-    vector<int> shortestPath(int src, int dest); // Dijkstra's algorithm
-    vector<pair<pair<int, int>, int>> minimumSpanningTree(); // Kruskal's algorithm
+    // Level-synchronous BFS on a thread pool (threads = 0: one per core), switching
+    // between top-down and bottom-up expansion. Same reached set as BFS, grouped by
+    // level (order within a level is unspecified). levels, when given, receives the
+    // hop count of every station (-1 if unreached); bottomUpLevels counts the levels
+    // expanded bottom-up. No output.
+    vector<int> parallelBFS(int startVertex, vector<int>* levels = nullptr, int threads = 0,
+                            int* bottomUpLevels = nullptr) const;
+    vector<int> shortestPath(int src, int dest, SearchStats* stats = nullptr); // Dijkstra's algorithm (binary heap)
+    vector<int> shortestPathBidirectional(int src, int dest, SearchStats* stats = nullptr); // Meet-in-the-middle Dijkstra
+    vector<int> shortestPathAt(int src, int dest, int departureTime, SearchStats* stats = nullptr); // Time-dependent Dijkstra
+    vector<int> aStar(int src, int dest, const Heuristic& heuristic, SearchStats* stats = nullptr); // A* search
+    vector<int> shortestPathLinearScan(int src, int dest); // Dijkstra's algorithm (O(V^2) reference)
+    
+    // Up to k loopless paths from src to dest in order of increasing cost (Yen's algorithm);
+    // costs, when given, receives the cost of each path. No output.
+    vector<vector<int>> kShortestPaths(int src, int dest, int k, vector<int>* costs = nullptr) const;
+    
+    // Many-to-many travel times: row-major |sources| x |targets| matrix,
+    // entry [i * |targets| + j] = d(sources[i], targets[j]), INT_MAX if unreachable.
+    // One Dijkstra per source on a thread pool (threads = 0: one per core); no paths, no output.
+    vector<int> distanceMatrix(const vector<int>& sources, const vector<int>& targets, int threads = 0) const;
+    
+    // Betweenness centrality (Brandes) over weighted shortest paths: for every station,
+    // the sum over ordered pairs (s, t) of the share of shortest s -> t paths through it.
+    // samples = 0 (or >= V) uses every source exactly; otherwise that many distinct
+    // pseudo-random sources, scaled by V / samples. Sources run on a thread pool
+    // (threads = 0: one per core). Route weights must be positive. No output.
+    vector<double> betweennessCentrality(int samples = 0, int threads = 0, unsigned int seed = 1) const;
+    // Minimum spanning forest over the routes u -> v with u < v, taken as undirected.
+    // All three variants return the same total weight; edges are ({smaller ID, larger ID}, weight).
+    vector<pair<pair<int, int>, int>> minimumSpanningTree(); // Kruskal's algorithm, edges in weight order
+    vector<pair<pair<int, int>, int>> minimumSpanningTreePrim() const; // Heap-based Prim, suits dense networks
+    vector<pair<pair<int, int>, int>> minimumSpanningTreeBoruvka(int threads = 0) const; // Parallel Boruvka
     bool detectCycle();
     
+    // Strongly connected components (iterative Tarjan) - Time: O(V+E), Space: O(V)
+    // component[v] receives the component of station v; returns the number of components.
+    // IDs are in reverse topological order: every route between two components
+    // leads from a higher ID to a lower one.
+    int stronglyConnectedComponents(vector<int>& component) const;
+    // Condensation DAG of those components in CSR form, one route per connected
+    // pair of components carrying the lightest route between them - Time: O(V+E)
+    CSRGraph condensation(const vector<int>& component, int numComponents) const;
+    
+    // Hub stations whose shortest path trees stay current through route changes
+    bool addHub(int station);
+    void removeHub(int station);
+    int hubDistance(int hub, int dest) const;     // INT_MAX if unreachable, -1 if hub is not tracked
+    vector<int> hubPath(int hub, int dest) const; // Empty if unreachable or not tracked
+    int getNumHubs() const { return hubTrees.size(); }
+    int getLastRepairCount() const { return lastRepairCount; }
+    
+    // Read-only snapshot in CSR form for query-heavy workloads
+    CSRGraph freeze() const;
+    CSRGraph freezeReverse() const;  // Same snapshot with every route reversed
+    
     // Utility
     int getNumVertices() const { return numVertices; }
+    int getNumRoutes() const { return edgePool.getLiveCount(); }
     bool stationExists(int id) const;
 };
 
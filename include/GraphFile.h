@@ -0,0 +1,101 @@
+#ifndef GRAPHFILE_H
+#define GRAPHFILE_H
+
+#include <vector>
+#include <string>
+#include <climits>
+#include "Graph.h"
+#include "Heap.h"
+
+using namespace std;
+
+// Versioned binary network file, served straight from a memory mapping
+//
+// Layout (native little-endian, every section 8-byte aligned):
+//   header        GraphFileHeader (64 bytes)
+//   station table StationRecord[numStations]  (ID, name in the pool, coordinates)
+//   station slots int[numVertices]            (station table index, -1 = no station)
+//   string pool   all station names back to back (not NUL-terminated)
+//   offsets       int[numVertices + 1]        (CSR, as in CSRGraph)
+//   targets       int[numEdges]
+//   weights       int[numEdges]
+// The header carries a 64-bit checksum of everything after it.
+//
+// open() maps the file read-only (POSIX mmap; a plain read into memory on
+// Windows), checks the header and section sizes, and validates every offset,
+// target and station index, so queries never follow an index out of the
+// mapping. verify() additionally recomputes the checksum over the whole file.
+struct GraphFileHeader {
+    char magic[4];            // "ITNG"
+    int version;
+    int numVertices;
+    int numStations;
+    long long numEdges;
+    long long stringPoolBytes;
+    long long fileBytes;
+    unsigned long long checksum;
+    long long reserved[2];
+};
+
+struct StationRecord {
+    int id;
+    int nameOffset;   // Into the string pool
+    int nameLength;
+    int hasCoordinates;
+    double x;
+    double y;
+};
+
+class MappedGraph {
+private:
+    const char* base;         // Start of the mapping
+    long long length;
+    void* handle;             // Heap buffer when mmap is unavailable
+    const GraphFileHeader* header;
+    const StationRecord* stationTable;
+    const int* stationSlots;
+    const char* stringPool;
+    const int* offsets;
+    const int* targets;
+    const int* weights;
+    
+    static long long align8(long long bytes) { return (bytes + 7) & ~7LL; }
+    static unsigned long long checksumOf(const char* data, long long bytes, unsigned long long hash);
+    bool attach();            // Points the section pointers into the mapping
+    bool checkStructure() const;  // Offsets, targets and station indexes in range
+
+public:
+    MappedGraph();
+    ~MappedGraph();
+    
+    // Mapping is owned, so the object must not be copied
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator=(const MappedGraph&) = delete;
+    
+    // Writes graph (stations, names, coordinates, static route weights) - Time: O(V+E)
+    static bool write(const Graph& graph, const string& filename);
+    
+    bool open(const string& filename);  // False if missing, wrong version, truncated or malformed
+    bool verify() const;                // Checksum and structure - Time: O(file size)
+    void close();
+    bool isOpen() const { return base != nullptr; }
+    
+    // Queries read the mapped arrays directly
+    int getNumVertices() const { return header ? header->numVertices : 0; }
+    int getNumStations() const { return header ? header->numStations : 0; }
+    long long getNumEdges() const { return header ? header->numEdges : 0; }
+    long long getFileBytes() const { return length; }
+    bool stationExists(int id) const;
+    string stationName(int id) const;   // Empty if there is no such station
+    bool stationCoordinates(int id, double& x, double& y) const;
+    int edgeBegin(int v) const { return offsets[v]; }
+    int edgeEnd(int v) const { return offsets[v + 1]; }
+    int edgeTarget(int e) const { return targets[e]; }
+    int edgeWeight(int e) const { return weights[e]; }
+    int getRouteWeight(int src, int dest) const;  // -1 if no such route
+    
+    vector<int> BFS(int startVertex) const;
+    vector<int> shortestPath(int src, int dest, int* distance = nullptr) const; // Dijkstra's algorithm
+};
+
+#endif
@@ -3,6 +3,10 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
+#include <climits>
+#include <cmath>
+#include "VehicleIndex.h"
 using namespace std;
 
 // Structure to represent a vehicle
@@ -12,7 +16,7 @@ struct Vehicle {
     string model;
     int capacity;
     double speed;  // km/h
-    Vehicle* next;  // For manual linked list
+    Vehicle* next;  // For manual linked list (ChainedHashTable)
     
     Vehicle(int i, string t, string m, int c, double s)
         : id(i), type(t), model(m), capacity(c), speed(s), next(nullptr) {}
@@ -22,7 +26,7 @@ struct Vehicle {
 class VehicleList {
 private:
     Vehicle* head;
-    
+
 public:
     VehicleList() : head(nullptr) {}
     
@@ -42,6 +46,23 @@ public:
         }
     }
     
+    // Update in place or append a copy, in a single walk - returns true if appended
+    bool upsert(const Vehicle& vehicle) {
+        Vehicle** link = &head;
+        while (*link != nullptr) {
+            if ((*link)->id == vehicle.id) {
+                (*link)->type = vehicle.type;
+                (*link)->model = vehicle.model;
+                (*link)->capacity = vehicle.capacity;
+                (*link)->speed = vehicle.speed;
+                return false;
+            }
+            link = &(*link)->next;
+        }
+        *link = new Vehicle(vehicle.id, vehicle.type, vehicle.model, vehicle.capacity, vehicle.speed);
+        return true;
+    }
+    
     void clear() {
         while (head != nullptr) {
             Vehicle* temp = head;
@@ -104,8 +125,9 @@ public:
     }
 };
 
-// Hash Table class with chaining (using manual linked lists)
-class HashTable {
+// Hash table with chaining (using manual linked lists) and a fixed bucket
+// count; kept as the reference the open-addressing HashTable is measured against
+class ChainedHashTable {
 private:
     static const int TABLE_SIZE = 101;  // Prime number for better distribution
     VehicleList table[TABLE_SIZE];  // Manual linked list instead of std::list
@@ -115,12 +137,13 @@ private:
     int hashFunction(int key) const {
         return key % TABLE_SIZE;
     }
-    
+
 public:
-    HashTable();
+    ChainedHashTable();
     
     // Hash table operations
     void insert(Vehicle vehicle);
+    int insertBatch(const vector<Vehicle>& vehicles);  // No output; returns the number of new vehicles
     Vehicle* search(int id);
     bool remove(int id);
     void display() const;
@@ -132,5 +155,108 @@ public:
     int getLongestChain() const;
 };
 
+// Conditions for HashTable::findVehicles; the defaults match every vehicle
+struct VehicleFilter {
+    string type;        // Empty = any type
+    int minCapacity;
+    int maxCapacity;
+    double minSpeed;
+    double maxSpeed;
+    VehicleFilter() : minCapacity(INT_MIN), maxCapacity(INT_MAX), minSpeed(-HUGE_VAL), maxSpeed(HUGE_VAL) {}
+};
+
+// Open-addressing vehicle hash table (Swiss-table style)
+//
+// Vehicles live in a dense array in insertion order (swap-with-last on
+// remove). The slot table holds one metadata byte per slot plus the dense
+// index of its vehicle:
+//   EMPTY (0x80), DELETED (0xFE, a tombstone), or the low 7 bits of the ID's
+//   hash for a used slot.
+// Slots are probed in aligned groups of 8: one 64-bit load of the group's
+// metadata bytes finds every slot whose 7-bit tag matches (and every empty
+// slot) with a few word operations, so only real candidates touch the dense
+// array. Groups are visited in triangular order, which covers every group of a
+// power-of-two table.
+//
+// The table grows (doubling) when used slots plus tombstones would exceed
+// maxLoadFactor of the capacity; a table mostly full of tombstones is rehashed
+// at the same size instead.
+//
+// Secondary indexes answer type/capacity/speed questions without scanning:
+// types are interned and every type lists the dense positions of its vehicles;
+// capacity and speed are kept in OrderedIndex range indexes of vehicle IDs.
+// insert, insertBatch, update, updateTelemetry and remove keep them in step;
+// search() hands out read-only pointers, so those are the only ways to change a
+// vehicle. The pointers stay valid until the next insert or remove.
+class HashTable {
+private:
+    static const unsigned char EMPTY = 0x80;
+    static const unsigned char DELETED = 0xFE;
+    static const int GROUP_SIZE = 8;
+    static const int RANGE_CANDIDATE_COST = 4;  // Query planning: one range candidate vs one type member
+    
+    vector<Vehicle> vehicles;      // Dense, insertion order
+    vector<unsigned char> control; // Metadata byte per slot
+    vector<int> slotIndex;         // Dense index of the vehicle in each used slot
+    int capacity;                  // Slots, a power of two and at least GROUP_SIZE
+    int tombstones;
+    double maxLoadFactor;
+    
+    // Secondary indexes
+    CategoryIndex typeIndex;       // Members are dense indices
+    OrderedIndex capacityIndex;    // Entries are vehicle IDs
+    OrderedIndex speedIndex;
+    vector<int> typeOf;            // Category of every dense vehicle
+    vector<int> typePosition;      // Its position in the category's member list
+    
+    // 64-bit mix of the ID; bits 0-6 are the tag, the rest pick the first group
+    static unsigned long long hashKey(int key);
+    int findSlot(int id, int* groupsProbed = nullptr) const;  // -1 if absent
+    int findInsertSlot(unsigned long long hash) const;  // First EMPTY or DELETED slot on the probe path
+    void rehash(int newCapacity);
+    void reserveForInsert();       // Grows or cleans up before adding one vehicle
+    void addNew(const Vehicle& vehicle, bool indexRanges = true);
+    void removeAt(int slot);
+    // Overwrites a stored vehicle; updateRanges = false for one not yet in the range indexes
+    void assignAt(int index, const Vehicle& vehicle, bool updateRanges = true);
+    void removeFromType(int index);
+    
+    // Checks one stored vehicle against a filter (category -1 = any type)
+    bool matches(int index, int category, const VehicleFilter& filter) const;
+
+public:
+    explicit HashTable(double maxLoadFactor = 0.875, int initialCapacity = 16);
+    
+    // Hash table operations
+    void insert(Vehicle vehicle);
+    int insertBatch(const vector<Vehicle>& batch);  // No output; returns the number of new vehicles
+    const Vehicle* search(int id) const;  // Read-only; change vehicles through update/updateTelemetry
+    bool remove(int id);
+    bool update(const Vehicle& vehicle);  // No output; false if the ID is absent
+    bool updateTelemetry(int id, int capacity, double speed);
+    void display() const;
+    void displayVehicle(int id) const;
+    int getNumVehicles() const { return vehicles.size(); }
+    void reserve(int numVehicles);  // Sizes the table so numVehicles fit without growing
+    void clear();
+    
+    // Dense storage in insertion order (reordered by removals)
+    const vector<Vehicle>& getAllVehicles() const { return vehicles; }
+    
+    // Indexed queries; IDs in index order (type: storage order, ranges: by value)
+    vector<int> findByType(const string& type) const;                  // Time: O(k)
+    vector<int> findByCapacity(int minCapacity, int maxCapacity) const; // Time: O(log n + k)
+    vector<int> findBySpeed(double minSpeed, double maxSpeed) const;   // Time: O(log n + k)
+    vector<int> findVehicles(const VehicleFilter& filter) const;
+    int countByType(const string& type) const;
+    int getNumTypes() const { return typeIndex.getNumCategories(); }
+    
+    // Statistics
+    double getLoadFactor() const;  // Vehicles per slot
+    double getMaxLoadFactor() const { return maxLoadFactor; }
+    int getCapacity() const { return capacity; }
+    int getLongestProbe() const;   // Most groups any lookup has to inspect
+};
+
 #endif
 
@@ -56,5 +56,37 @@ public:
     static void heapSort(vector<VehiclePriority>& arr);
 };
 
+// Indexed Min-Heap keyed by vertex ID (Priority Queue for Dijkstra)
+// Each vertex appears at most once, so its priority can be lowered in place.
+// Ties on priority are broken by the smaller vertex ID.
+class IndexedMinHeap {
+private:
+    vector<int> heap;      // Vertex IDs in heap order
+    vector<int> position;  // position[v] = index of v in heap, -1 if absent
+    vector<int> key;       // key[v] = current priority of v
+    
+    // Helper functions
+    bool lessThan(int i, int j) const;
+    void swapNodes(int i, int j);
+    void heapifyUp(int index);
+    void heapifyDown(int index);
+    int parent(int index) const { return (index - 1) / 2; }
+    int leftChild(int index) const { return 2 * index + 1; }
+    int rightChild(int index) const { return 2 * index + 2; }
+    
+public:
+    IndexedMinHeap(int capacity = 0);
+    
+    // Heap operations
+    void reset(int capacity);
+    void clear();  // Empties the heap in O(size), keeping capacity
+    void insert(int vertex, int priority);  // Inserts, or lowers an existing key
+    int extractMin();
+    int peekKey() const;
+    bool contains(int vertex) const;
+    bool isEmpty() const;
+    int getSize() const;
+};
+
 #endif
 
@@ -0,0 +1,102 @@
+#ifndef HEURISTIC_H
+#define HEURISTIC_H
+
+#include <vector>
+#include <string>
+using namespace std;
+
+class Graph;
+class CSRGraph;
+
+// Pluggable lower bound for Graph::aStar
+// estimate(v, target) must never exceed the true shortest distance from v
+// to target (admissible); returning 0 everywhere turns A* into Dijkstra.
+class Heuristic {
+public:
+    virtual ~Heuristic() {}
+    virtual int estimate(int vertex, int target) const = 0;
+};
+
+// Zero heuristic - A* degenerates to plain Dijkstra
+class ZeroHeuristic : public Heuristic {
+public:
+    int estimate(int, int) const { return 0; }
+};
+
+// Geometric heuristic built from station coordinates
+// The straight-line (EUCLIDEAN, planar x/y) or great-circle (GREAT_CIRCLE,
+// x = latitude, y = longitude in degrees, distances in km) distance is
+// divided by the maximum network speed, i.e. the largest length/weight
+// ratio over all routes, so no route is faster than the estimate assumes.
+// If any route touches a station without coordinates the speed cannot be
+// bounded and every estimate is 0.
+class CoordinateHeuristic : public Heuristic {
+public:
+    enum Metric { EUCLIDEAN, GREAT_CIRCLE };
+    
+private:
+    Metric metric;
+    vector<double> xs;
+    vector<double> ys;
+    vector<bool> located;
+    double costPerUnit;  // 1 / maximum network speed
+    
+    double distance(int a, int b) const;
+    
+public:
+    CoordinateHeuristic(const Graph& graph, Metric m = EUCLIDEAN);
+    
+    int estimate(int vertex, int target) const;
+    double getMaxSpeed() const;  // Length units per weight unit, 0 if unbounded
+};
+
+// ALT heuristic (A*, Landmarks, Triangle inequality)
+// For a few landmarks L the exact distances d(L, v) and d(v, L) are
+// precomputed for every vertex. By the triangle inequality
+//   d(v, t) >= d(L, t) - d(L, v)   and   d(v, t) >= d(v, L) - d(t, L),
+// and the largest of these bounds is an admissible and consistent estimate
+// that needs no coordinates.
+// Landmarks are chosen greedily: FARTHEST picks the station farthest from
+// the landmarks chosen so far; AVOID (Goldberg & Werneck) grows a shortest
+// path tree from a root and descends into the subtree whose distances are
+// covered worst by the current landmarks.
+// Tables are stored flat (landmark-major, V ints per landmark) and can be
+// saved to / loaded from a binary file. A fingerprint of the routes is kept
+// so a stale file can be detected with matches().
+class LandmarkHeuristic : public Heuristic {
+public:
+    enum Selection { FARTHEST, AVOID };
+    
+private:
+    int numVertices;
+    int numLandmarks;
+    unsigned long long fingerprint;  // Hash of the route set the tables were built from
+    vector<int> landmarks;
+    vector<int> fromLandmark;  // [l * numVertices + v] = d(landmarks[l], v), INT_MAX if unreachable
+    vector<int> toLandmark;    // [l * numVertices + v] = d(v, landmarks[l]), INT_MAX if unreachable
+    
+    void addLandmark(int vertex, const CSRGraph& forward, const CSRGraph& backward);
+    int selectFarthest(const vector<bool>& isStation) const;
+    int selectAvoid(const CSRGraph& forward, const vector<bool>& isStation, int root) const;
+    static unsigned long long computeFingerprint(const CSRGraph& forward);
+    
+public:
+    LandmarkHeuristic();
+    LandmarkHeuristic(const Graph& graph, int k, Selection selection = AVOID);
+    
+    // Preprocessing - Time: O(k (V+E) log V), Space: O(kV)
+    void build(const Graph& graph, int k, Selection selection = AVOID);
+    
+    // Estimate - Time: O(k), Space: O(1)
+    int estimate(int vertex, int target) const;
+    
+    // Flat binary serialization
+    bool save(const string& filename) const;
+    bool load(const string& filename);
+    bool matches(const Graph& graph) const;  // Tables built from this exact route set
+    
+    int getNumLandmarks() const { return numLandmarks; }
+    const vector<int>& getLandmarks() const { return landmarks; }
+};
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <sstream>
+
+using namespace std;
+
+// Per-operation messages of the data structures ("Route added ...", "Vehicle
+// not found!") go through Logger instead of writing to cout with endl, so they
+// can be filtered by level, redirected to a file, or compiled out entirely.
+//
+//   LOG_INFO("Route added from station " << src << " to " << dest);
+//
+// Runtime: Logger::setLevel() drops messages below the level (default INFO)
+// before they are formatted. Compile time: building with
+// -DITNMS_LOG_MIN_LEVEL=4 (LOG_LEVEL_OFF) turns every LOG_* statement into dead
+// code, so the core structures carry no logging cost at all; 3 keeps errors only.
+enum LogLevel {
+    LOG_LEVEL_DEBUG = 0,
+    LOG_LEVEL_INFO = 1,
+    LOG_LEVEL_WARNING = 2,
+    LOG_LEVEL_ERROR = 3,
+    LOG_LEVEL_OFF = 4
+};
+
+#ifndef ITNMS_LOG_MIN_LEVEL
+#define ITNMS_LOG_MIN_LEVEL 0
+#endif
+
+// Destination of the log lines (one call per message, no trailing newline)
+class LogSink {
+public:
+    virtual ~LogSink() {}
+    virtual void write(LogLevel level, const string& message) = 0;
+    virtual void flush() {}
+};
+
+// Default sink: the message text as before, on cout, ended with '\n' instead of
+// endl. Nothing is flushed per message; cin is tied to cout, so pending output
+// still appears before the next prompt.
+class ConsoleSink : public LogSink {
+public:
+    void write(LogLevel level, const string& message);
+    void flush();
+};
+
+// Block-buffered writer over a FILE: bytes collect in memory and reach the
+// file in buffer-sized fwrite() calls (and on flush() or destruction)
+class BufferedWriter {
+private:
+    FILE* file;
+    bool ownsFile;
+    vector<char> buffer;
+    size_t used;
+
+public:
+    explicit BufferedWriter(FILE* target = nullptr, size_t capacity = 64 * 1024);
+    ~BufferedWriter();
+    
+    // Owns the FILE when opened by name, so the object must not be copied
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+    
+    bool open(const string& filename, bool append = false);
+    void close();
+    bool isOpen() const { return file != nullptr; }
+    
+    void write(const char* data, size_t length);
+    void write(const string& text) { write(text.data(), text.size()); }
+    void flush();
+};
+
+// Log file sink: "[LEVEL] message" lines through a BufferedWriter
+class FileSink : public LogSink {
+private:
+    BufferedWriter writer;
+
+public:
+    FileSink() {}
+    explicit FileSink(const string& filename, bool append = false) { writer.open(filename, append); }
+    bool open(const string& filename, bool append = false) { return writer.open(filename, append); }
+    bool isOpen() const { return writer.isOpen(); }
+    void write(LogLevel level, const string& message);
+    void flush() { writer.flush(); }
+};
+
+// Process-wide level and sink; writes are serialised with a mutex
+class Logger {
+public:
+    static void setLevel(LogLevel level);
+    static LogLevel getLevel();
+    static bool isEnabled(LogLevel level);
+    
+    // nullptr restores the ConsoleSink; the sink is not owned and must outlive its use
+    static void setSink(LogSink* sink);
+    static LogSink* getSink();
+    
+    static void write(LogLevel level, const string& message);
+    static void flush();
+    static const char* levelName(LogLevel level);
+};
+
+// One message being formatted; handed to Logger when the statement ends
+class LogLine {
+private:
+    LogLevel level;
+    ostringstream text;
+
+public:
+    explicit LogLine(LogLevel messageLevel) : level(messageLevel) {}
+    ~LogLine() { Logger::write(level, text.str()); }
+    ostringstream& stream() { return text; }
+};
+
+#define ITNMS_LOG(level, message)                                                  \
+    do {                                                                           \
+        if ((level) >= ITNMS_LOG_MIN_LEVEL && Logger::isEnabled(level)) {          \
+            LogLine logLine(level);                                                \
+            logLine.stream() << message;                                           \
+        }                                                                          \
+    } while (0)
+
+#define LOG_DEBUG(message) ITNMS_LOG(LOG_LEVEL_DEBUG, message)
+#define LOG_INFO(message) ITNMS_LOG(LOG_LEVEL_INFO, message)
+#define LOG_WARNING(message) ITNMS_LOG(LOG_LEVEL_WARNING, message)
+#define LOG_ERROR(message) ITNMS_LOG(LOG_LEVEL_ERROR, message)
+
+#endif
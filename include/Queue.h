@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 using namespace std;
 
 // Structure to represent a passenger
@@ -35,6 +36,7 @@ public:
     
     // Queue operations
     void enqueue(Passenger passenger);
+    void enqueueBatch(const vector<Passenger>& passengers);  // In order, no output
     Passenger dequeue();
     Passenger peek() const;
     bool isEmpty() const;
@@ -0,0 +1,62 @@
+#ifndef REACHABILITY_H
+#define REACHABILITY_H
+
+#include <vector>
+#include "Graph.h"
+#include "CSRGraph.h"
+
+using namespace std;
+
+// "Can station A still reach station B?" answered from strongly connected
+// components, for network health checks after closures
+//
+// build() collapses the network into its components (Graph::
+// stronglyConnectedComponents) and their condensation DAG, then computes the
+// DAG's transitive closure as bit rows. Component IDs are in reverse
+// topological order, so component c can only reach IDs below c and its row
+// needs just c bits: the whole closure takes about C² / 16 bytes for C
+// components and is filled in one pass in ID order (each row ORs the rows of
+// its direct successors).
+//
+// Queries are O(1): same component, or one bit test. If the closure would
+// exceed the memory budget given to build(), queries fall back to a DFS over
+// the DAG that skips components with a lower ID than the target's.
+// Later changes to the Graph are not reflected until the next build().
+class ReachabilityIndex {
+private:
+    int numComponents;
+    vector<int> component;            // Component of every station
+    vector<int> componentSize;
+    CSRGraph dag;                     // Condensation, routes lead to lower IDs
+    vector<long long> rowOffsets;     // Size C+1, start of each closure row (in words)
+    vector<unsigned long long> closure;
+    bool hasClosure;
+    
+    // Fallback DFS workspace (generation-stamped)
+    mutable vector<int> visitMark;
+    mutable int visitStamp;
+    mutable vector<int> stack;
+    
+    bool searchDAG(int from, int to) const;
+
+public:
+    ReachabilityIndex();
+    
+    // Time: O(V+E) for the components plus O(C * DAG routes / 64) for the closure
+    // Returns true if the closure fit in maxClosureBytes (O(1) queries)
+    bool build(const Graph& graph, long long maxClosureBytes = 64LL * 1024 * 1024);
+    
+    // False for station IDs outside the indexed range
+    bool canReach(int from, int to) const;
+    bool mutuallyReachable(int a, int b) const;
+    
+    int componentOf(int station) const;  // -1 if out of range
+    int getComponentSize(int id) const;
+    int getNumComponents() const { return numComponents; }
+    int getLargestComponent() const;     // -1 if nothing is indexed
+    const CSRGraph& getCondensation() const { return dag; }
+    bool isConstantTime() const { return hasClosure; }
+    long long getMemoryUsage() const;    // Bytes held by the closure rows
+};
+
+#endif
@@ -41,10 +41,39 @@ public:
     // Radix Sort - Time: O(d*(n+k)), Space: O(n+k) where d is digits
     static void radixSort(vector<int>& arr);
     
+    // Stable Merge Sort - bottom-up, ordered by less(a, b); equal items keep
+    // their order, and input already in order is returned after one pass
+    // Time: O(n log n), Space: O(n)
+    template <typename T, typename Less>
+    static void stableSort(vector<T>& items, Less less) {
+        int n = items.size();
+        bool inOrder = true;
+        for (int i = 1; i < n && inOrder; i++) {
+            if (less(items[i], items[i - 1])) inOrder = false;
+        }
+        if (inOrder) return;
+        
+        vector<T> buffer(n);
+        for (int width = 1; width < n; width *= 2) {
+            for (int left = 0; left < n; left += 2 * width) {
+                int mid = left + width < n ? left + width : n;
+                int right = left + 2 * width < n ? left + 2 * width : n;
+                int i = left, j = mid, k = left;
+                while (i < mid && j < right) {
+                    if (less(items[j], items[i])) buffer[k++] = items[j++];
+                    else buffer[k++] = items[i++];
+                }
+                while (i < mid) buffer[k++] = items[i++];
+                while (j < right) buffer[k++] = items[j++];
+            }
+            items.swap(buffer);
+        }
+    }
+    
     // Utility functions
     static void displayArray(const vector<int>& arr);
     static void printComplexity(const string& algorithm);
-    
+
 private:
     // Helper functions for merge sort
     static void merge(vector<int>& arr, int left, int mid, int right);
@@ -0,0 +1,52 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+using namespace std;
+
+// Fixed-size pool of worker threads for data-parallel loops
+//
+// parallelFor(count, body) calls body(index, worker) once for every index in
+// [0, count). Indices are handed out one at a time through an atomic counter,
+// so uneven tasks balance themselves. worker is in [0, getNumThreads()) and
+// lets the caller keep one scratch workspace per thread. The calling thread
+// takes part as worker 0, so a pool of 1 thread runs everything inline.
+// parallelFor must not be called from several threads at once.
+class ThreadPool {
+private:
+    vector<thread> workers;
+    mutex lock;
+    condition_variable wake;      // Signals a new job (or shutdown) to workers
+    condition_variable finished;  // Signals the caller that all workers are idle
+    const function<void(int, int)>* body;
+    atomic<int> nextTask;
+    int taskCount;
+    int generation;   // Incremented once per job so workers never run one twice
+    int busyWorkers;
+    bool stopping;
+    
+    void workerLoop(int worker);
+    void runTasks(const function<void(int, int)>& job, int worker);
+
+public:
+    explicit ThreadPool(int numThreads = 0);  // 0 = one thread per hardware core
+    ~ThreadPool();
+    
+    // Pool owns running threads, so it must not be copied
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    
+    // Runs body(index, worker) for every index in [0, count) and waits for completion
+    void parallelFor(int count, const function<void(int, int)>& job);
+    
+    int getNumThreads() const { return workers.size() + 1; }
+    static int hardwareThreads();  // At least 1
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef TIMEPROFILE_H
+#define TIMEPROFILE_H
+
+#include <vector>
+
+using namespace std;
+
+// Shared store of periodic piecewise-linear travel-time profiles
+//
+// A profile is a list of breakpoints (time, travelTime) with strictly
+// increasing times in [0, period); the travel time at any other moment is
+// interpolated linearly, wrapping from the last breakpoint to the first one
+// of the next period. All breakpoints of all profiles live in two flat
+// arrays indexed through offsets, and identical profiles are stored once,
+// so edges only carry a profile ID and many routes can share one curve.
+//
+// Every segment must satisfy the FIFO property (travel time never drops
+// faster than the clock advances), so departing later never means arriving
+// earlier and a plain Dijkstra on arrival times stays exact.
+class TravelTimeProfiles {
+private:
+    int period;
+    vector<int> offsets;      // Size P+1, breakpoint range of each profile
+    vector<int> times;        // Breakpoint times, ascending per profile
+    vector<int> travelTimes;  // Travel time at each breakpoint
+    vector<int> internTable;  // Open-addressing table of profile IDs (-1 = empty)
+    
+    unsigned int hashPoints(const vector<int>& pointTimes, const vector<int>& values) const;
+    bool samePoints(int id, const vector<int>& pointTimes, const vector<int>& values) const;
+    void growInternTable();
+
+public:
+    TravelTimeProfiles(int periodLength = 1440);  // Default period: minutes in a day
+    
+    // Adds a profile, or returns the ID of an identical one - Time: O(points)
+    // Returns -1 (and prints why) if the breakpoints are invalid or break FIFO
+    int addProfile(const vector<int>& pointTimes, const vector<int>& values);
+    
+    // Travel time when entering the edge at time t - Time: O(log points), Space: O(1)
+    int evaluate(int id, int t) const;
+    int minTravelTime(int id) const;  // Lower bound over the whole period
+    
+    int getPeriod() const { return period; }
+    int getNumProfiles() const { return (int)offsets.size() - 1; }
+    int getNumPoints() const { return times.size(); }
+    long long getMemoryUsage() const;  // Bytes held by the flat arrays
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef TIMETABLE_H
+#define TIMETABLE_H
+
+#include <vector>
+#include <climits>
+
+using namespace std;
+
+class Graph;
+
+// Scheduled services over the Graph's stations, queried with RAPTOR
+// (Round-bAsed Public Transit Optimized Router, Delling et al.)
+//
+// A route is a fixed sequence of stops; a trip is one vehicle running that
+// sequence, with an arrival and departure time at every stop. Transfers are
+// walking links between stops. Times are integers (e.g. seconds since
+// midnight; trips after midnight simply use times past 24:00).
+//
+// finalize() (called automatically by the first query after an edit) packs
+// everything into flat arrays: stops per route, trips per route with their
+// stop times laid out trip-major, routes serving each stop, and transfers in
+// CSR form. Trips of a route are sorted by departure; trips that overtake
+// one another are split into separate routes so that the earliest catchable
+// trip can be found by binary search.
+//
+// Round k of a query scans only routes touching a stop improved in round
+// k-1, so the result of round k is the earliest arrival using at most k trips.
+class Timetable {
+private:
+    int numStops;
+    const Graph* graph;
+    bool dirty;
+    
+    // Staging area filled by addRoute/addTrip/addTransfer
+    vector<int> patternOffsets, patternStops;
+    vector<int> tripPattern, tripOffsets, tripArrivals, tripDepartures;
+    vector<int> transferFrom, transferTo, transferWalk;
+    
+    // Flat query arrays built by finalize()
+    vector<int> routeStopOffsets, routeStops;     // Stop sequence of each route
+    vector<int> routeTripCount, routeTimeOffsets; // Trips per route, start of its stop times
+    vector<int> arrivals, departures;             // [routeTimeOffsets[r] + trip * stops + i]
+    vector<int> stopRouteOffsets, stopRoutes, stopRoutePositions; // Routes serving each stop
+    vector<int> transferOffsets, transferTargets, transferTimes;
+    
+    // Query workspaces
+    vector<int> earliest;     // Best arrival found so far
+    vector<int> boardable;    // Best arrival as of the end of the previous round
+    vector<int> marked;       // Stops improved in the current round
+    vector<bool> isMarked;
+    vector<int> queuedRoutes;
+    vector<int> routeQueuePos; // Earliest marked position per queued route, -1 if not queued
+    int lastRounds;
+    
+    void sortTripsByDeparture(vector<int>& trips) const;
+    bool overtakes(int laterTrip, int earlierTrip, int stops) const;
+    int findTrip(int route, int position, int time) const;
+    void run(int src, int departureTime, int dest, int maxRounds);
+    void improve(int stop, int time);
+
+public:
+    Timetable(const Graph& network);
+    
+    // Timetable construction - stops are station IDs of the network
+    int addRoute(const vector<int>& stops);  // Route ID, -1 if invalid
+    bool addTrip(int route, const vector<int>& arrivalTimes, const vector<int>& departureTimes);
+    bool addTransfer(int from, int to, int walkTime);
+    void finalize();  // Time: O(T log T + stop times)
+    
+    // Earliest arrival at dest leaving src no earlier than departureTime,
+    // using at most maxRounds trips; INT_MAX if unreachable
+    int earliestArrival(int src, int dest, int departureTime, int maxRounds = 8);
+    // Earliest arrival at every stop (INT_MAX where unreachable)
+    vector<int> earliestArrivalAll(int src, int departureTime, int maxRounds = 8);
+    
+    int getNumRoutes();    // After splitting overtaking trips
+    int getNumTrips() const { return tripPattern.size(); }
+    int getNumStopTimes() const { return tripArrivals.size(); }
+    int getNumTransfers() const { return transferFrom.size(); }
+    int getLastRounds() const { return lastRounds; }  // Rounds used by the latest query
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef VEHICLEINDEX_H
+#define VEHICLEINDEX_H
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Ordered secondary index of (key, vehicle ID) pairs, for range questions such
+// as "capacity between 150 and 300" or "speed at least 80"
+//
+// Entries are kept sorted by key, ties by ID, in a list of sorted blocks of at
+// most BLOCK_SIZE entries (a two-level B+ tree). A binary search over the last
+// entry of every block picks the block, a second one the position inside it;
+// inserts and removals shift at most one block and split or drop blocks as
+// they fill or empty. A range query reads its result contiguously, block
+// after block, and never looks at entries outside the range.
+//
+// A NaN key is indexed as +infinity.
+class OrderedIndex {
+public:
+    struct Entry {
+        double key;
+        int id;
+    };
+
+private:
+    static const int BLOCK_SIZE = 512;
+    
+    vector<vector<Entry> > blocks;   // Sorted, none empty
+    vector<Entry> blockLast;         // Last entry of every block
+    int count;
+    
+    static double normalize(double key);
+    static bool less(double keyA, int idA, double keyB, int idB);
+    int findBlock(double key, int id) const;          // First block whose last entry is not below (key, id)
+    static int lowerBound(const vector<Entry>& block, double key, int id);
+
+public:
+    OrderedIndex() : count(0) {}
+    
+    void insert(double key, int id);      // Time: O(log n + BLOCK_SIZE)
+    void insertBatch(const vector<Entry>& batch);  // Sorts and merges a large batch
+    bool remove(double key, int id);      // False if the pair is not indexed
+    void clear();
+    
+    // IDs with low <= key <= high, in key order - Time: O(log n + k)
+    void findRange(double low, double high, vector<int>& ids) const;
+    int countRange(double low, double high) const;   // Time: O(log n + k / BLOCK_SIZE)
+    
+    int size() const { return count; }
+    int getNumBlocks() const { return blocks.size(); }
+};
+
+// Interned category names (vehicle types) and the members of every category
+//
+// Each distinct name gets a small integer once; a sorted copy of the names
+// finds it again by binary search. Members are stored per category as
+// caller-supplied handles in an unordered list; the caller keeps each member's
+// position (returned by add) so it can be removed or relocated in O(1).
+class CategoryIndex {
+private:
+    vector<string> names;            // By category ID
+    vector<int> sortedIds;           // Category IDs ordered by name
+    vector<vector<int> > members;    // Handles by category
+    
+    int searchName(const string& name, int& position) const;
+
+public:
+    int intern(const string& name);             // Existing or new category ID
+    int find(const string& name) const;         // -1 if never seen
+    const string& getName(int category) const { return names[category]; }
+    int getNumCategories() const { return names.size(); }
+    
+    // Membership - Time: O(1)
+    int add(int category, int handle);          // Returns the handle's position
+    int removeAt(int category, int position);   // Returns the handle moved into position, -1 if none
+    void replaceAt(int category, int position, int handle) { members[category][position] = handle; }
+    const vector<int>& getMembers(int category) const { return members[category]; }
+    void clear();                               // Drops members, keeps the interned names
+};
+
+#endif
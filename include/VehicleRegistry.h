@@ -0,0 +1,130 @@
+#ifndef VEHICLEREGISTRY_H
+#define VEHICLEREGISTRY_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include "HashTable.h"
+
+using namespace std;
+
+// Concurrent vehicle database for telemetry ingest (writers) and dispatch
+// lookups (readers) running on many threads at once.
+//
+// Vehicles are spread over a power-of-two number of shards by ID hash. Each
+// shard has its own writer mutex and an open-addressing table of pointers to
+// immutable vehicle records (linear probing, at most half full).
+//
+// Writers (insert, remove, updateTelemetry) lock one shard, build a new record
+// and publish it with a single atomic store; the replaced record, or the old
+// table after a resize, is retired rather than freed.
+//
+// Readers take no lock and never retry: a lookup announces the current epoch
+// in its thread's reader slot, probes the table, copies what it needs and
+// clears the slot - a bounded number of steps whatever the writers do
+// (wait-free). Every published record is complete, so a reader sees either the
+// old or the new capacity/speed pair, never a mix.
+//
+// Retired memory is freed by the shard's writers (epoch-based reclamation)
+// once no reader that could still hold it is active: the global epoch is
+// advanced and everything retired before the oldest announced epoch goes.
+// Reader slots are handed out per thread; threads beyond MAX_READERS fall back
+// to locking the shard. No console output.
+class VehicleRegistry {
+public:
+    static const int MAX_READERS = 256;
+    static const int MAX_SHARDS = 1024;
+
+private:
+    static const int MIN_TABLE = 16;
+    static const size_t RECLAIM_BATCH = 64;
+    
+    struct Record {
+        int id;
+        string type;
+        string model;
+        int capacity;
+        double speed;
+        Record(int i, const string& t, const string& m, int c, double s)
+            : id(i), type(t), model(m), capacity(c), speed(s) {}
+    };
+    
+    struct Table {
+        int capacity;                 // Power of two
+        atomic<Record*>* slots;       // nullptr = empty, tombstone() = removed
+        explicit Table(int size);
+        ~Table();
+    };
+    
+    struct Retired {
+        Record* record;               // Exactly one of record / table is set
+        Table* table;
+        unsigned long long epoch;
+    };
+    
+    struct Shard {
+        mutex writer;
+        atomic<Table*> table;
+        atomic<int> live;
+        int usedSlots;                // Live plus tombstones (writer only)
+        vector<Retired> retired;      // Writer only
+        size_t reclaimAt;             // Retired size that triggers the next reclaim
+        char padding[64];             // Keeps neighbouring shards off one cache line
+        Shard() : table(nullptr), live(0), usedSlots(0), reclaimAt(RECLAIM_BATCH) {}
+    };
+    
+    struct ReaderSlot {
+        atomic<unsigned long long> epoch;  // 0 = not reading
+        char padding[64 - sizeof(atomic<unsigned long long>)];
+        ReaderSlot() : epoch(0) {}
+    };
+    
+    int numShards;
+    Shard* shards;
+    atomic<unsigned long long> globalEpoch;
+    ReaderSlot* readers;              // MAX_READERS slots
+    
+    static Record* tombstone();
+    static unsigned long long hashKey(int id);
+    Shard& shardOf(unsigned long long hash) const { return shards[(hash >> 40) & (numShards - 1)]; }
+    
+    // Probe for id; returns the slot or -1 (empty slot reached)
+    static int findSlot(const Table* table, int id, unsigned long long hash);
+    
+    // Writer-side helpers (shard mutex held)
+    void retire(Shard& shard, Record* record, Table* table);
+    void reclaim(Shard& shard);
+    void rebuild(Shard& shard);
+    
+    // Lock-free probe of one shard; the caller has announced an epoch or holds the lock
+    const Record* find(int id) const;
+    
+    // Reader-side epoch announcement; returns the slot, -1 if the thread has none
+    int beginRead() const;
+    void endRead(int slot) const;
+
+public:
+    explicit VehicleRegistry(int shardCount = 64);  // Rounded up to a power of two, at most MAX_SHARDS
+    ~VehicleRegistry();
+    
+    // Owns shards and records, so the object must not be copied
+    VehicleRegistry(const VehicleRegistry&) = delete;
+    VehicleRegistry& operator=(const VehicleRegistry&) = delete;
+    
+    // Writers - per-shard lock, Average Time: O(1)
+    bool insert(const Vehicle& vehicle);      // True if new; an existing ID is replaced
+    bool remove(int id);
+    bool updateTelemetry(int id, int capacity, double speed);  // False if absent
+    
+    // Readers - wait-free, Average Time: O(1)
+    bool lookup(int id, Vehicle& result) const;                 // Copies the vehicle
+    bool getTelemetry(int id, int& capacity, double& speed) const;
+    bool contains(int id) const;
+    
+    int getNumVehicles() const;
+    int getNumShards() const { return numShards; }
+    long long getPendingReclaim() const;      // Retired records and tables not yet freed
+};
+
+#endif
@@ -1,6 +1,7 @@
 #include "Analytics.h"
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 
 Analytics::Analytics(Graph* g, HashTable* h, BST* b, Heap* hp)
     : transportGraph(g), vehicleDB(h), routeMetadata(b), vehiclePriority(hp) {
@@ -72,11 +73,11 @@ void Analytics::resetStatistics() {
 
 // Most Crowded Station - Uses hash frequency count
 // Time: O(n), Space: O(n)
-void Analytics::mostCrowdedStation() {
-    cout << "\n=== Most Crowded Station Analysis ===" << endl;
+void Analytics::mostCrowdedStation(ostream& out) {
+    out << "\n=== Most Crowded Station Analysis ===\n";
     
     if (stationFrequency.empty()) {
-        cout << "No station usage data available." << endl;
+        out << "No station usage data available.\n" << flush;
         return;
     }
     
@@ -93,12 +94,12 @@ void Analytics::mostCrowdedStation() {
     
     if (crowdedStationId != -1) {
         Station* station = transportGraph->getStation(crowdedStationId);
-        cout << "Most Crowded Station:" << endl;
-        cout << "  ID: " << crowdedStationId << endl;
+        out << "Most Crowded Station:\n";
+        out << "  ID: " << crowdedStationId << '\n';
         if (station) {
-            cout << "  Name: " << station->name << endl;
+            out << "  Name: " << station->name << '\n';
         }
-        cout << "  Passenger Count: " << maxCount << endl;
+        out << "  Passenger Count: " << maxCount << '\n';
     }
     
     // Display top 5 stations - Manual sorting
@@ -109,49 +110,37 @@ void Analytics::mostCrowdedStation() {
     }
     sortPairsDescending(sortedStations);
     
-    cout << "\nTop 5 Busiest Stations:" << endl;
+    out << "\nTop 5 Busiest Stations:\n";
     int count = 0;
     for (size_t i = 0; i < sortedStations.size() && count < 5; i++) {
         Station* station = transportGraph->getStation(sortedStations[i].second);
-        cout << (count + 1) << ". Station " << sortedStations[i].second;
+        out << (count + 1) << ". Station " << sortedStations[i].second;
         if (station) {
-            cout << " (" << station->name << ")";
+            out << " (" << station->name << ")";
         }
-        cout << " - " << sortedStations[i].first << " passengers" << endl;
+        out << " - " << sortedStations[i].first << " passengers\n";
         count++;
     }
+    out.flush();
 }
 
 // Busiest Route - Graph edge weight statistics
 // Time: O(V+E), Space: O(E)
-void Analytics::busiestRoute() {
-    cout << "\n=== Busiest Route Analysis ===" << endl;
-    
-    vector<pair<pair<int, int>, int>> routes;
-    
-    // Collect all routes with their weights
-    for (int i = 0; i < transportGraph->getNumVertices(); i++) {
-        vector<Station> stations = transportGraph->getAllStations();
-        for (const auto& station : stations) {
-            if (station.id == i) {
-                // Get connections for this station
-                // Note: This requires access to adjacency list, simplified here
-                break;
-            }
-        }
-    }
+void Analytics::busiestRoute(ostream& out) {
+    out << "\n=== Busiest Route Analysis ===\n";
     
     // Get routes from MST (represents all active routes)
     vector<pair<pair<int, int>, int>> mst = transportGraph->minimumSpanningTree();
     
     if (mst.empty()) {
-        cout << "No routes available for analysis." << endl;
+        out << "No routes available for analysis.\n" << flush;
         return;
     }
     
-    // Sort by weight (higher weight = busier route) - Manual sorting
+    // Selection sort by weight (higher weight = busier route), stopped after
+    // the 5 routes that are reported - Time: O(5n) instead of O(n²)
     int n = mst.size();
-    for (int i = 0; i < n - 1; i++) {
+    for (int i = 0; i < n - 1 && i < 5; i++) {
         int maxIdx = i;
         for (int j = i + 1; j < n; j++) {
             if (mst[j].second > mst[maxIdx].second) {
@@ -165,59 +154,61 @@ void Analytics::busiestRoute() {
         }
     }
     
-    cout << "Top 5 Busiest Routes:" << endl;
+    out << "Top 5 Busiest Routes:\n";
     int count = 0;
     for (const auto& route : mst) {
         if (count >= 5) break;
         Station* srcStation = transportGraph->getStation(route.first.first);
         Station* destStation = transportGraph->getStation(route.first.second);
         
-        cout << (count + 1) << ". Route: ";
+        out << (count + 1) << ". Route: ";
         if (srcStation) {
-            cout << srcStation->name;
+            out << srcStation->name;
         } else {
-            cout << "Station " << route.first.first;
+            out << "Station " << route.first.first;
         }
-        cout << " -> ";
+        out << " -> ";
         if (destStation) {
-            cout << destStation->name;
+            out << destStation->name;
         } else {
-            cout << "Station " << route.first.second;
+            out << "Station " << route.first.second;
         }
-        cout << " | Weight/Traffic: " << route.second << endl;
+        out << " | Weight/Traffic: " << route.second << '\n';
         count++;
     }
+    out.flush();
 }
 
 // Fastest Vehicle Assignment - Min-heap
 // Time: O(log n), Space: O(1)
-void Analytics::fastestVehicleAssignment() {
-    cout << "\n=== Fastest Vehicle Assignment ===" << endl;
+void Analytics::fastestVehicleAssignment(ostream& out) {
+    out << "\n=== Fastest Vehicle Assignment ===\n";
     
     if (vehiclePriority->isEmpty()) {
-        cout << "No vehicles available in priority queue." << endl;
+        out << "No vehicles available in priority queue.\n" << flush;
         return;
     }
     
     VehiclePriority fastest = vehiclePriority->peek();
-    Vehicle* vehicle = vehicleDB->search(fastest.vehicleId);
+    const Vehicle* vehicle = vehicleDB->search(fastest.vehicleId);
     
     if (vehicle) {
-        cout << "Fastest Available Vehicle:" << endl;
-        cout << "  ID: " << vehicle->id << endl;
-        cout << "  Type: " << vehicle->type << endl;
-        cout << "  Model: " << vehicle->model << endl;
-        cout << "  Speed: " << vehicle->speed << " km/h" << endl;
-        cout << "  Capacity: " << vehicle->capacity << " passengers" << endl;
+        out << "Fastest Available Vehicle:\n";
+        out << "  ID: " << vehicle->id << '\n';
+        out << "  Type: " << vehicle->type << '\n';
+        out << "  Model: " << vehicle->model << '\n';
+        out << "  Speed: " << vehicle->speed << " km/h\n";
+        out << "  Capacity: " << vehicle->capacity << " passengers\n";
     }
     
-    cout << "\nNote: Use 'Display Priority Queue' in Vehicle Menu to see all vehicles." << endl;
+    out << "\nNote: Use 'Display Priority Queue' in Vehicle Menu to see all vehicles.\n";
+    out.flush();
 }
 
 // Traffic Density Prediction - Heap sorting
 // Time: O(n log n), Space: O(n)
-void Analytics::trafficDensityPrediction() {
-    cout << "\n=== Traffic Density Prediction ===" << endl;
+void Analytics::trafficDensityPrediction(ostream& out) {
+    out << "\n=== Traffic Density Prediction ===\n";
     
     // Simulate traffic density based on station frequency
     vector<pair<int, int>> densityData;
@@ -228,14 +219,14 @@ void Analytics::trafficDensityPrediction() {
     }
     
     if (densityData.empty()) {
-        cout << "Insufficient data for traffic density prediction." << endl;
+        out << "Insufficient data for traffic density prediction.\n" << flush;
         return;
     }
     
     // Sort by density (using manual sorting)
     sortDensityData(densityData);
     
-    cout << "Traffic Density Prediction (High to Low):" << endl;
+    out << "Traffic Density Prediction (High to Low):\n";
     int count = 0;
     for (const auto& data : densityData) {
         if (count >= 10) break;
@@ -246,37 +237,38 @@ void Analytics::trafficDensityPrediction() {
         else if (data.first > 15) densityLevel = "Medium";
         else densityLevel = "Low";
         
-        cout << (count + 1) << ". Station " << data.second;
+        out << (count + 1) << ". Station " << data.second;
         if (station) {
-            cout << " (" << station->name << ")";
+            out << " (" << station->name << ")";
         }
-        cout << " - Density: " << densityLevel 
-             << " (" << data.first << " passengers)" << endl;
+        out << " - Density: " << densityLevel 
+             << " (" << data.first << " passengers)\n";
         count++;
     }
+    out.flush();
 }
 
 // Daily Usage Trends - BST traversal
 // Time: O(n), Space: O(n)
-void Analytics::dailyUsageTrends() {
-    cout << "\n=== Daily Usage Trends ===" << endl;
+void Analytics::dailyUsageTrends(ostream& out) {
+    out << "\n=== Daily Usage Trends ===\n";
     
     if (routeMetadata->isEmpty()) {
-        cout << "No route metadata available." << endl;
+        out << "No route metadata available.\n" << flush;
         return;
     }
     
     vector<RouteMetadata> routes = routeMetadata->getAllRoutes();
     
     if (routes.empty()) {
-        cout << "No routes available." << endl;
+        out << "No routes available.\n" << flush;
         return;
     }
     
     // Sort by passenger count - Manual sorting
     sortRoutesByPassengers(routes);
     
-    cout << "Daily Usage Trends (by Passenger Count):" << endl;
+    out << "Daily Usage Trends (by Passenger Count):\n";
     int totalPassengers = 0;
     for (const auto& route : routes) {
         totalPassengers += route.passengerCount;
@@ -286,40 +278,106 @@ void Analytics::dailyUsageTrends() {
         double percentage = totalPassengers > 0 ? 
             (routes[i].passengerCount * 100.0 / totalPassengers) : 0;
         
-        cout << (i + 1) << ". Route " << routes[i].routeId 
-             << " (" << routes[i].routeName << ")" << endl;
-        cout << "   Passengers: " << routes[i].passengerCount 
-             << " (" << fixed << setprecision(2) << percentage << "%)" << endl;
-        cout << "   Average Time: " << routes[i].averageTime << " minutes" << endl;
+        out << (i + 1) << ". Route " << routes[i].routeId 
+             << " (" << routes[i].routeName << ")\n";
+        out << "   Passengers: " << routes[i].passengerCount 
+             << " (" << fixed << setprecision(2) << percentage << "%)\n";
+        out << "   Average Time: " << routes[i].averageTime << " minutes\n";
     }
     
-    cout << "\nTotal Passengers Across All Routes: " << totalPassengers << endl;
+    out << "\nTotal Passengers Across All Routes: " << totalPassengers << '\n';
+    out.flush();
 }
 
-// Generate Comprehensive Report
-void Analytics::generateReport() {
-    cout << "\n" << string(60, '=') << endl;
-    cout << "     INTELLIGENT TRANSPORT NETWORK MANAGEMENT SYSTEM" << endl;
-    cout << "                    ANALYTICS REPORT" << endl;
-    cout << string(60, '=') << endl;
-    
-    mostCrowdedStation();
-    cout << endl;
-    
-    busiestRoute();
-    cout << endl;
-    
-    fastestVehicleAssignment();
-    cout << endl;
-    
-    trafficDensityPrediction();
-    cout << endl;
+// Critical Stations - ranks stations by betweenness centrality
+// (shortest paths passing through them: where a closure hurts most)
+// Time: O(S (V+E) log V / threads) for S sources, Space: O(threads V)
+void Analytics::criticalStations(ostream& out, int samples) {
+    out << "\n=== Critical Stations (Betweenness Centrality) ===\n";
+    
+    int n = transportGraph->getNumVertices();
+    if (transportGraph->getNumRoutes() == 0) {
+        out << "No routes available for analysis.\n" << flush;
+        return;
+    }
+    if (samples < 0) samples = (n <= 1000) ? 0 : 256;
+    
+    vector<double> centrality = transportGraph->betweennessCentrality(samples);
+    vector<pair<double, int>> ranked;
+    double total = 0.0;
+    for (int v = 0; v < n; v++) {
+        if (centrality[v] > 0.0) ranked.push_back({centrality[v], v});
+        total += centrality[v];
+    }
+    if (ranked.empty()) {
+        out << "No station lies inside a shortest path.\n" << flush;
+        return;
+    }
     
-    dailyUsageTrends();
-    cout << endl;
+    // Selection sort (descending), stopped after the 10 stations that are reported
+    int m = ranked.size();
+    for (int i = 0; i < m - 1 && i < 10; i++) {
+        int maxIdx = i;
+        for (int j = i + 1; j < m; j++) {
+            if (ranked[j].first > ranked[maxIdx].first) {
+                maxIdx = j;
+            }
+        }
+        if (maxIdx != i) {
+            pair<double, int> temp = ranked[i];
+            ranked[i] = ranked[maxIdx];
+            ranked[maxIdx] = temp;
+        }
+    }
     
-    cout << string(60, '=') << endl;
-    cout << "                    END OF REPORT" << endl;
-    cout << string(60, '=') << endl;
+    if (samples > 0 && samples < n) {
+        out << "(Estimated from " << samples << " sampled source stations)\n";
+    }
+    out << "Top Critical Stations:\n";
+    for (int i = 0; i < m && i < 10; i++) {
+        Station* station = transportGraph->getStation(ranked[i].second);
+        out << (i + 1) << ". ";
+        if (station) {
+            out << station->name << " (ID: " << ranked[i].second << ")";
+        } else {
+            out << "Station " << ranked[i].second;
+        }
+        out << " - Betweenness: " << fixed << setprecision(1) << ranked[i].first
+             << " (" << setprecision(2) << ranked[i].first * 100.0 / total << "% of path load)\n";
+    }
+    out.flush();
 }
 
+// Generate Comprehensive Report - the sections are collected in memory and
+// written to out in one piece, so the sections' own flushes cost nothing
+void Analytics::generateReport(ostream& out) {
+    ostringstream report;
+    report << "\n" << string(60, '=') << '\n';
+    report << "     INTELLIGENT TRANSPORT NETWORK MANAGEMENT SYSTEM\n";
+    report << "                    ANALYTICS REPORT\n";
+    report << string(60, '=') << '\n';
+    
+    mostCrowdedStation(report);
+    report << '\n';
+    
+    busiestRoute(report);
+    report << '\n';
+    
+    fastestVehicleAssignment(report);
+    report << '\n';
+    
+    trafficDensityPrediction(report);
+    report << '\n';
+    
+    dailyUsageTrends(report);
+    report << '\n';
+    
+    criticalStations(report);
+    report << '\n';
+    
+    report << string(60, '=') << '\n';
+    report << "                    END OF REPORT\n";
+    report << string(60, '=') << '\n';
+    out << report.str();
+    out.flush();
+}
@@ -1,4 +1,6 @@
 #include "BST.h"
+#include "Logger.h"
+#include "SearchSort.h"
 #include <iostream>
 
 BST::BST() : root(nullptr), size(0) {}
@@ -28,7 +30,61 @@ BSTNode* BST::insertHelper(BSTNode* node, RouteMetadata data) {
 
 void BST::insert(RouteMetadata data) {
     root = insertHelper(root, data);
-    cout << "Route metadata inserted: " << data.routeName << " (ID: " << data.routeId << ")" << endl;
+    LOG_INFO("Route metadata inserted: " << data.routeName << " (ID: " << data.routeId << ")");
+}
+
+// Balanced subtree over sorted[low..high] - Time: O(n), Space: O(log n)
+BSTNode* BST::buildBalanced(const vector<RouteMetadata>& sorted, int low, int high) {
+    if (low > high) return nullptr;
+    int mid = low + (high - low) / 2;
+    BSTNode* node = new BSTNode(sorted[mid]);
+    node->left = buildBalanced(sorted, low, mid - 1);
+    node->right = buildBalanced(sorted, mid + 1, high);
+    return node;
+}
+
+int BST::insertBatch(const vector<RouteMetadata>& routes) {
+    int before = size;
+    int n = routes.size();
+    if (n == 0) return 0;
+    
+    // Few records into a large tree: plain inserts are cheaper than a rebuild
+    if ((long long)n * 16 < size) {
+        for (int i = 0; i < n; i++) {
+            root = insertHelper(root, routes[i]);
+        }
+        return size - before;
+    }
+    
+    // Stable sort of record indices by route ID
+    // (skipped when the file is already in ID order)
+    vector<int> order(n);
+    for (int i = 0; i < n; i++) order[i] = i;
+    SearchSort::stableSort(order, [&routes](int a, int b) {
+        return routes[a].routeId < routes[b].routeId;
+    });
+    
+    // Merge with the current contents; the last record of an ID wins
+    vector<RouteMetadata> existing;
+    inorderHelper(root, existing);
+    vector<RouteMetadata> merged;
+    merged.reserve(existing.size() + n);
+    size_t e = 0;
+    int b = 0;
+    while (b < n) {
+        int id = routes[order[b]].routeId;
+        while (b + 1 < n && routes[order[b + 1]].routeId == id) b++;
+        while (e < existing.size() && existing[e].routeId < id) merged.push_back(existing[e++]);
+        if (e < existing.size() && existing[e].routeId == id) e++;
+        merged.push_back(routes[order[b]]);
+        b++;
+    }
+    while (e < existing.size()) merged.push_back(existing[e++]);
+    
+    clear();
+    root = buildBalanced(merged, 0, (int)merged.size() - 1);
+    size = merged.size();
+    return size - before;
 }
 
 // Search - Average Time: O(log n), Worst: O(n), Space: O(log n)
@@ -95,10 +151,10 @@ bool BST::remove(int routeId) {
     int oldSize = size;
     root = deleteHelper(root, routeId);
     if (size < oldSize) {
-        cout << "Route " << routeId << " deleted successfully!" << endl;
+        LOG_INFO("Route " << routeId << " deleted successfully!");
         return true;
     }
-    cout << "Route " << routeId << " not found!" << endl;
+    LOG_WARNING("Route " << routeId << " not found!");
     return false;
 }
 
@@ -114,9 +170,9 @@ void BST::displayInorder() {
     vector<RouteMetadata> result;
     inorderHelper(root, result);
     
-    cout << "\n=== Routes (Inorder Traversal) ===" << endl;
+    cout << "\n=== Routes (Inorder Traversal) ===\n";
     if (result.empty()) {
-        cout << "No routes available." << endl;
+        cout << "No routes available.\n";
         return;
     }
     
@@ -124,7 +180,7 @@ void BST::displayInorder() {
         cout << "Route ID: " << route.routeId 
              << " | Name: " << route.routeName
              << " | Passengers: " << route.passengerCount
-             << " | Avg Time: " << route.averageTime << " min" << endl;
+             << " | Avg Time: " << route.averageTime << " min\n";
     }
 }
 
@@ -140,15 +196,15 @@ void BST::displayPreorder() {
     vector<RouteMetadata> result;
     preorderHelper(root, result);
     
-    cout << "\n=== Routes (Preorder Traversal) ===" << endl;
+    cout << "\n=== Routes (Preorder Traversal) ===\n";
     if (result.empty()) {
-        cout << "No routes available." << endl;
+        cout << "No routes available.\n";
         return;
     }
     
     for (const auto& route : result) {
         cout << "Route ID: " << route.routeId 
-             << " | Name: " << route.routeName << endl;
+             << " | Name: " << route.routeName << '\n';
     }
 }
 
@@ -164,15 +220,15 @@ void BST::displayPostorder() {
     vector<RouteMetadata> result;
     postorderHelper(root, result);
     
-    cout << "\n=== Routes (Postorder Traversal) ===" << endl;
+    cout << "\n=== Routes (Postorder Traversal) ===\n";
     if (result.empty()) {
-        cout << "No routes available." << endl;
+        cout << "No routes available.\n";
         return;
     }
     
     for (const auto& route : result) {
         cout << "Route ID: " << route.routeId 
-             << " | Name: " << route.routeName << endl;
+             << " | Name: " << route.routeName << '\n';
     }
 }
 
@@ -0,0 +1,455 @@
+#include "BulkLoader.h"
+#include <cstring>
+#include <cstdlib>
+#include <climits>
+#include <chrono>
+#include <iostream>
+
+CsvReader::CsvReader(size_t bufferSize)
+    : file(nullptr), buffer((bufferSize > 0 ? bufferSize : 1) + 1, '\0'), begin(0), end(0),
+      atEnd(false), lineNumber(0), recordNumber(0), bytesRead(0) {}
+
+CsvReader::~CsvReader() {
+    close();
+}
+
+bool CsvReader::open(const string& filename) {
+    close();
+    file = fopen(filename.c_str(), "rb");
+    begin = end = 0;
+    buffer[0] = '\0';
+    atEnd = false;
+    lineNumber = recordNumber = bytesRead = 0;
+    return file != nullptr;
+}
+
+void CsvReader::close() {
+    if (file != nullptr) fclose(file);
+    file = nullptr;
+    fieldStart.clear();
+    fieldLength.clear();
+    fieldQuoted.clear();
+}
+
+// Refill - Time: O(unread tail + chunk)
+bool CsvReader::refill() {
+    if (atEnd) return false;
+    size_t remaining = end - begin;
+    if (begin > 0) {
+        memmove(buffer.data(), buffer.data() + begin, remaining);
+        begin = 0;
+        end = remaining;
+    }
+    if (end == buffer.size() - 1) buffer.resize((buffer.size() - 1) * 2 + 1);  // Line longer than the buffer
+    
+    size_t wanted = buffer.size() - 1 - end;
+    size_t got = fread(buffer.data() + end, 1, wanted, file);
+    end += got;
+    bytesRead += got;
+    buffer[end] = '\0';
+    if (got < wanted) atEnd = true;
+    return got > 0;
+}
+
+// Next record - Time: O(line length) amortized
+bool CsvReader::next() {
+    fieldStart.clear();
+    fieldLength.clear();
+    fieldQuoted.clear();
+    if (file == nullptr) return false;
+    
+    while (true) {
+        const char* data = buffer.data();
+        const char* newline = static_cast<const char*>(memchr(data + begin, '\n', end - begin));
+        if (newline == nullptr && !atEnd) {
+            refill();
+            continue;
+        }
+        if (newline == nullptr && begin == end) return false;
+        
+        // Last line of the file may lack its newline
+        const char* line = data + begin;
+        const char* lineEnd = (newline != nullptr) ? newline : data + end;
+        begin = (lineEnd - data) + (newline != nullptr ? 1 : 0);
+        lineNumber++;
+        if (lineEnd > line && lineEnd[-1] == '\r') lineEnd--;
+        
+        const char* p = line;
+        while (p < lineEnd && (*p == ' ' || *p == '\t')) p++;
+        if (p == lineEnd) continue;
+        
+        splitFields(line, lineEnd);
+        recordNumber++;
+        return true;
+    }
+}
+
+void CsvReader::splitFields(const char* line, const char* lineEnd) {
+    const char* p = line;
+    while (true) {
+        while (p < lineEnd && (*p == ' ' || *p == '\t')) p++;
+        if (p < lineEnd && *p == '"') {
+            // Quoted: runs to the first quote that is not doubled
+            const char* start = p + 1;
+            const char* q = start;
+            while (q < lineEnd) {
+                if (*q == '"') {
+                    if (q + 1 < lineEnd && q[1] == '"') q += 2;
+                    else break;
+                } else {
+                    q++;
+                }
+            }
+            fieldStart.push_back(start);
+            fieldLength.push_back(q - start);
+            fieldQuoted.push_back(1);
+            p = (q < lineEnd) ? q + 1 : lineEnd;
+            while (p < lineEnd && *p != ',') p++;
+        } else {
+            const char* start = p;
+            while (p < lineEnd && *p != ',') p++;
+            const char* stop = p;
+            while (stop > start && (stop[-1] == ' ' || stop[-1] == '\t')) stop--;
+            fieldStart.push_back(start);
+            fieldLength.push_back(stop - start);
+            fieldQuoted.push_back(0);
+        }
+        if (p >= lineEnd) break;
+        p++;  // Past the comma
+    }
+}
+
+bool CsvReader::getInt(int field, int& value) const {
+    if (field < 0 || field >= getFieldCount()) return false;
+    return parseInt(fieldStart[field], fieldLength[field], value);
+}
+
+bool CsvReader::getDouble(int field, double& value) const {
+    if (field < 0 || field >= getFieldCount()) return false;
+    return parseDouble(fieldStart[field], fieldLength[field], value);
+}
+
+string CsvReader::getString(int field) const {
+    if (field < 0 || field >= getFieldCount()) return "";
+    const char* text = fieldStart[field];
+    int length = fieldLength[field];
+    if (!fieldQuoted[field]) return string(text, length);
+    
+    string result;
+    result.reserve(length);
+    for (int i = 0; i < length; i++) {
+        result += text[i];
+        if (text[i] == '"' && i + 1 < length && text[i + 1] == '"') i++;
+    }
+    return result;
+}
+
+// Parse Int - optional sign, decimal digits, overflow checked - Time: O(length)
+bool CsvReader::parseInt(const char* text, int length, int& value) {
+    int i = 0;
+    bool negative = false;
+    if (length > 0 && (text[0] == '-' || text[0] == '+')) {
+        negative = (text[0] == '-');
+        i = 1;
+    }
+    if (i >= length) return false;
+    
+    long long result = 0;
+    for (; i < length; i++) {
+        char c = text[i];
+        if (c < '0' || c > '9') return false;
+        result = result * 10 + (c - '0');
+        if (result > 2147483648LL) return false;
+    }
+    if (negative) result = -result;
+    if (result > INT_MAX) return false;
+    value = (int)result;
+    return true;
+}
+
+// Parse Double - Time: O(length)
+// Decimal mantissa and exponent are collected by hand; when the mantissa fits in
+// 53 bits and the power of ten is at most 10^22, both are exact doubles and one
+// multiplication or division rounds correctly. Anything else goes to strtod.
+bool CsvReader::parseDouble(const char* text, int length, double& value) {
+    static const double powers[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    
+    int i = 0;
+    bool negative = false;
+    if (length > 0 && (text[0] == '-' || text[0] == '+')) {
+        negative = (text[0] == '-');
+        i = 1;
+    }
+    
+    unsigned long long mantissa = 0;
+    int significant = 0;
+    int exponent = 0;
+    bool anyDigits = false;
+    bool exact = true;
+    for (; i < length && text[i] >= '0' && text[i] <= '9'; i++) {
+        anyDigits = true;
+        if (significant < 19) {
+            mantissa = mantissa * 10 + (text[i] - '0');
+            if (mantissa != 0) significant++;
+        } else {
+            exponent++;
+            if (text[i] != '0') exact = false;
+        }
+    }
+    if (i < length && text[i] == '.') {
+        for (i++; i < length && text[i] >= '0' && text[i] <= '9'; i++) {
+            anyDigits = true;
+            if (significant < 19) {
+                mantissa = mantissa * 10 + (text[i] - '0');
+                if (mantissa != 0) significant++;
+                exponent--;
+            } else if (text[i] != '0') {
+                exact = false;
+            }
+        }
+    }
+    if (!anyDigits) return false;
+    
+    if (i < length && (text[i] == 'e' || text[i] == 'E')) {
+        i++;
+        bool negativeExponent = false;
+        if (i < length && (text[i] == '-' || text[i] == '+')) {
+            negativeExponent = (text[i] == '-');
+            i++;
+        }
+        if (i >= length) return false;
+        int written = 0;
+        for (; i < length && text[i] >= '0' && text[i] <= '9'; i++) {
+            if (written < 100000) written = written * 10 + (text[i] - '0');
+        }
+        exponent += negativeExponent ? -written : written;
+    }
+    if (i != length) return false;
+    
+    if (exact && mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+        double result = (double)mantissa;
+        result = (exponent < 0) ? result / powers[-exponent] : result * powers[exponent];
+        value = negative ? -result : result;
+        return true;
+    }
+    
+    // Slow path on a terminated copy; the syntax is already checked
+    string copy(text, length);
+    value = strtod(copy.c_str(), nullptr);
+    return true;
+}
+
+BulkLoader::BulkLoader(size_t bufferSize, int batchSize)
+    : bufferSize(bufferSize), batchSize(batchSize > 0 ? batchSize : 1) {}
+
+// Stamps the elapsed time and bytes read, hands the stats to the caller
+static void finishLoad(const CsvReader& reader, LoadStats& result,
+                       chrono::high_resolution_clock::time_point start, LoadStats* stats) {
+    result.bytes = reader.getBytesRead();
+    result.elapsedMs = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+    if (stats != nullptr) *stats = result;
+}
+
+void BulkLoader::reject(const CsvReader& reader, LoadStats& stats) {
+    if (stats.firstRejectedLine == 0) stats.firstRejectedLine = reader.getLineNumber();
+    stats.rejected++;
+}
+
+// A non-numeric first field in the first record is a column header; anywhere
+// else the line is malformed
+bool BulkLoader::skipHeaderOrReject(const CsvReader& reader, LoadStats& stats) {
+    if (reader.getRecordNumber() == 1) return true;
+    reject(reader, stats);
+    return false;
+}
+
+// Load Stations - Time: O(file size + max station ID)
+bool BulkLoader::loadStations(const string& filename, Graph& graph, LoadStats* stats) {
+    auto start = chrono::high_resolution_clock::now();
+    CsvReader reader(bufferSize);
+    if (!reader.open(filename)) return false;
+    
+    LoadStats result;
+    vector<Station> batch;
+    batch.reserve(batchSize);
+    while (reader.next()) {
+        int id;
+        double x, y;
+        int fields = reader.getFieldCount();
+        if (!reader.getInt(0, id)) {
+            skipHeaderOrReject(reader, result);
+            continue;
+        }
+        if ((fields != 2 && fields != 4) || id < 0) {
+            reject(reader, result);
+            continue;
+        }
+        if (fields == 4) {
+            if (!reader.getDouble(2, x) || !reader.getDouble(3, y)) {
+                reject(reader, result);
+                continue;
+            }
+            batch.push_back(Station(id, reader.getString(1), x, y));
+        } else {
+            batch.push_back(Station(id, reader.getString(1)));
+        }
+        result.records++;
+        
+        if ((int)batch.size() == batchSize) {
+            result.skipped += batch.size() - graph.addStations(batch);
+            batch.clear();
+        }
+    }
+    result.skipped += batch.size() - graph.addStations(batch);
+    finishLoad(reader, result, start, stats);
+    return true;
+}
+
+// Load Routes - Time: O(file size + sum of out-degrees touched)
+bool BulkLoader::loadRoutes(const string& filename, Graph& graph, LoadStats* stats) {
+    auto start = chrono::high_resolution_clock::now();
+    CsvReader reader(bufferSize);
+    if (!reader.open(filename)) return false;
+    
+    LoadStats result;
+    vector<RouteRecord> batch;
+    batch.reserve(batchSize);
+    while (reader.next()) {
+        int src, dest, weight;
+        if (!reader.getInt(0, src)) {
+            skipHeaderOrReject(reader, result);
+            continue;
+        }
+        if (reader.getFieldCount() != 3 || !reader.getInt(1, dest) || !reader.getInt(2, weight) ||
+            src < 0 || dest < 0 || weight < 0) {
+            reject(reader, result);
+            continue;
+        }
+        batch.push_back(RouteRecord(src, dest, weight));
+        result.records++;
+        
+        if ((int)batch.size() == batchSize) {
+            result.skipped += batch.size() - graph.addRoutes(batch);
+            batch.clear();
+        }
+    }
+    result.skipped += batch.size() - graph.addRoutes(batch);
+    finishLoad(reader, result, start, stats);
+    return true;
+}
+
+// Load Vehicles - Time: O(file size) plus the hash table inserts
+bool BulkLoader::loadVehicles(const string& filename, HashTable& vehicles, LoadStats* stats) {
+    auto start = chrono::high_resolution_clock::now();
+    CsvReader reader(bufferSize);
+    if (!reader.open(filename)) return false;
+    
+    LoadStats result;
+    vector<Vehicle> batch;
+    batch.reserve(batchSize);
+    while (reader.next()) {
+        int id, capacity;
+        double speed;
+        if (!reader.getInt(0, id)) {
+            skipHeaderOrReject(reader, result);
+            continue;
+        }
+        if (reader.getFieldCount() != 5 || !reader.getInt(3, capacity) || !reader.getDouble(4, speed) || id < 0) {
+            reject(reader, result);
+            continue;
+        }
+        batch.push_back(Vehicle(id, reader.getString(1), reader.getString(2), capacity, speed));
+        result.records++;
+        
+        if ((int)batch.size() == batchSize) {
+            vehicles.insertBatch(batch);
+            batch.clear();
+        }
+    }
+    vehicles.insertBatch(batch);
+    finishLoad(reader, result, start, stats);
+    return true;
+}
+
+// Load Route Metadata - Time: O(file size + batches * tree size)
+bool BulkLoader::loadRouteMetadata(const string& filename, BST& routes, LoadStats* stats) {
+    auto start = chrono::high_resolution_clock::now();
+    CsvReader reader(bufferSize);
+    if (!reader.open(filename)) return false;
+    
+    LoadStats result;
+    vector<RouteMetadata> batch;
+    batch.reserve(batchSize);
+    while (reader.next()) {
+        int id;
+        int count = 0;
+        double time = 0.0;
+        int fields = reader.getFieldCount();
+        if (!reader.getInt(0, id)) {
+            skipHeaderOrReject(reader, result);
+            continue;
+        }
+        if ((fields != 2 && fields != 4) ||
+            (fields == 4 && (!reader.getInt(2, count) || !reader.getDouble(3, time)))) {
+            reject(reader, result);
+            continue;
+        }
+        batch.push_back(RouteMetadata(id, reader.getString(1), count, time));
+        result.records++;
+        
+        if ((int)batch.size() == batchSize) {
+            routes.insertBatch(batch);
+            batch.clear();
+        }
+    }
+    routes.insertBatch(batch);
+    finishLoad(reader, result, start, stats);
+    return true;
+}
+
+// Load Passengers - Time: O(file size)
+bool BulkLoader::loadPassengers(const string& filename, Queue& passengers, LoadStats* stats) {
+    auto start = chrono::high_resolution_clock::now();
+    CsvReader reader(bufferSize);
+    if (!reader.open(filename)) return false;
+    
+    LoadStats result;
+    vector<Passenger> batch;
+    batch.reserve(batchSize);
+    while (reader.next()) {
+        int id, src, dest;
+        if (!reader.getInt(0, id)) {
+            skipHeaderOrReject(reader, result);
+            continue;
+        }
+        if (reader.getFieldCount() != 4 || !reader.getInt(2, src) || !reader.getInt(3, dest)) {
+            reject(reader, result);
+            continue;
+        }
+        batch.push_back(Passenger(id, reader.getString(1), src, dest));
+        result.records++;
+        
+        if ((int)batch.size() == batchSize) {
+            passengers.enqueueBatch(batch);
+            batch.clear();
+        }
+    }
+    passengers.enqueueBatch(batch);
+    finishLoad(reader, result, start, stats);
+    return true;
+}
+
+void BulkLoader::printStats(const string& what, const LoadStats& stats) {
+    cout << "Loaded " << stats.records << " " << what << " in " << stats.elapsedMs << " ms ("
+         << (long long)stats.recordsPerSecond() << " records/sec, "
+         << stats.bytes / 1024 << " KB)";
+    if (stats.skipped > 0) cout << ", " << stats.skipped << " skipped";
+    if (stats.rejected > 0) {
+        cout << ", " << stats.rejected << " malformed line(s) rejected (first: line "
+             << stats.firstRejectedLine << ")";
+    }
+    cout << endl;
+}
@@ -0,0 +1,270 @@
+#include "CSRGraph.h"
+
+CSRGraph::CSRGraph() : numVertices(0) {
+    offsets.push_back(0);
+}
+
+// BFS Implementation - Time: O(V+E), Space: O(V)
+// The result array doubles as the FIFO queue (visit order == enqueue order)
+vector<int> CSRGraph::BFS(int startVertex) const {
+    vector<int> result;
+    if (startVertex < 0 || startVertex >= numVertices) return result;
+    
+    vector<bool> visited(numVertices, false);
+    visited[startVertex] = true;
+    result.push_back(startVertex);
+    
+    for (size_t head = 0; head < result.size(); head++) {
+        int v = result[head];
+        for (int e = offsets[v]; e < offsets[v + 1]; e++) {
+            int w = targets[e];
+            if (!visited[w]) {
+                visited[w] = true;
+                result.push_back(w);
+            }
+        }
+    }
+    
+    return result;
+}
+
+// DFS Implementation - Time: O(V+E), Space: O(V)
+// Explicit stack of (vertex, next edge) reproduces the recursive visit order
+vector<int> CSRGraph::DFS(int startVertex) const {
+    vector<int> result;
+    if (startVertex < 0 || startVertex >= numVertices) return result;
+    
+    vector<bool> visited(numVertices, false);
+    vector<int> stackVertex;
+    vector<int> stackEdge;
+    
+    visited[startVertex] = true;
+    result.push_back(startVertex);
+    stackVertex.push_back(startVertex);
+    stackEdge.push_back(offsets[startVertex]);
+    
+    while (!stackVertex.empty()) {
+        int v = stackVertex.back();
+        int& e = stackEdge.back();
+        if (e == offsets[v + 1]) {
+            stackVertex.pop_back();
+            stackEdge.pop_back();
+            continue;
+        }
+        
+        int w = targets[e];
+        e++;
+        if (!visited[w]) {
+            visited[w] = true;
+            result.push_back(w);
+            stackVertex.push_back(w);
+            stackEdge.push_back(offsets[w]);
+        }
+    }
+    
+    return result;
+}
+
+// Dijkstra's Algorithm - Time: O((V+E) log V) with indexed min-heap, Space: O(V)
+// Silent variant of Graph::shortestPath; the distance is returned through 'distance'
+vector<int> CSRGraph::shortestPath(int src, int dest, int* distance) const {
+    return dijkstra(offsets.data(), targets.data(), weights.data(), numVertices, src, dest, distance);
+}
+
+// Dijkstra's Algorithm - Time: O((V+E) log V) with indexed min-heap, Space: O(V)
+vector<int> CSRGraph::dijkstra(const int* offsets, const int* targets, const int* weights,
+                               int numVertices, int src, int dest, int* distance) {
+    if (distance) *distance = INT_MAX;
+    if (src < 0 || dest < 0 || src >= numVertices || dest >= numVertices) return vector<int>();
+    
+    vector<int> dist(numVertices, INT_MAX);
+    vector<int> parent(numVertices, -1);
+    vector<bool> visited(numVertices, false);
+    IndexedMinHeap pq(numVertices);
+    
+    dist[src] = 0;
+    pq.insert(src, 0);
+    
+    while (!pq.isEmpty()) {
+        int u = pq.extractMin();
+        visited[u] = true;
+        if (u == dest) break;
+        
+        for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+            int v = targets[e];
+            if (!visited[v] && dist[u] + weights[e] < dist[v]) {
+                dist[v] = dist[u] + weights[e];
+                parent[v] = u;
+                pq.insert(v, dist[v]);
+            }
+        }
+    }
+    
+    if (dist[dest] == INT_MAX) return vector<int>();
+    if (distance) *distance = dist[dest];
+    return buildPath(parent, dest);
+}
+
+// Reconstruct path manually (no std::reverse) - Time: O(path length), Space: O(path length)
+vector<int> CSRGraph::buildPath(const vector<int>& parent, int dest) {
+    vector<int> path;
+    int current = dest;
+    while (current != -1) {
+        path.push_back(current);
+        current = parent[current];
+    }
+    // Manual reverse
+    int n = path.size();
+    for (int i = 0; i < n / 2; i++) {
+        int temp = path[i];
+        path[i] = path[n - 1 - i];
+        path[n - 1 - i] = temp;
+    }
+    return path;
+}
+
+// Union-Find find with iterative path compression - Time: O(α(V)) amortized
+int CSRGraph::findParent(vector<int>& parent, int i) {
+    int root = i;
+    while (parent[root] != root) {
+        root = parent[root];
+    }
+    while (parent[i] != root) {
+        int next = parent[i];
+        parent[i] = root;
+        i = next;
+    }
+    return root;
+}
+
+// Union by rank of two roots
+void CSRGraph::unionSets(vector<int>& parent, vector<int>& rank, int x, int y) {
+    int xRoot = findParent(parent, x);
+    int yRoot = findParent(parent, y);
+    
+    if (rank[xRoot] < rank[yRoot]) {
+        parent[xRoot] = yRoot;
+    } else if (rank[xRoot] > rank[yRoot]) {
+        parent[yRoot] = xRoot;
+    } else {
+        parent[yRoot] = xRoot;
+        rank[xRoot]++;
+    }
+}
+
+// Manual sorting for MST edges - LSD radix sort, one byte of the weight per pass
+// Stable, so equal-weight edges keep their collection order. Passes whose byte
+// is the same for every edge (e.g. the high bytes of small weights) are skipped.
+// Time: O(E) (at most 4 passes), Space: O(E)
+void CSRGraph::sortEdges(vector<pair<int, pair<int, int>>>& edges) {
+    int n = edges.size();
+    vector<pair<int, pair<int, int>>> buffer(n);
+    
+    for (int shift = 0; shift < 32; shift += 8) {
+        int count[257] = {0};
+        for (int i = 0; i < n; i++) {
+            // Flipping the sign bit orders negative weights before positive ones
+            unsigned int key = (unsigned int)edges[i].first ^ 0x80000000u;
+            count[((key >> shift) & 255) + 1]++;
+        }
+        bool trivial = false;
+        for (int b = 1; b <= 256; b++) {
+            if (count[b] == n) trivial = true;
+        }
+        if (trivial) continue;
+        
+        for (int b = 0; b < 256; b++) {
+            count[b + 1] += count[b];
+        }
+        for (int i = 0; i < n; i++) {
+            unsigned int key = (unsigned int)edges[i].first ^ 0x80000000u;
+            buffer[count[(key >> shift) & 255]++] = edges[i];
+        }
+        edges.swap(buffer);
+    }
+}
+
+// Kruskal's Algorithm for MST - Time: O(E α(V)) after the O(E) radix sort, Space: O(V+E)
+vector<pair<pair<int, int>, int>> CSRGraph::minimumSpanningTree() const {
+    // Collect all edges
+    vector<pair<int, pair<int, int>>> edges;
+    for (int u = 0; u < numVertices; u++) {
+        for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+            if (u < targets[e]) { // Avoid duplicates
+                edges.push_back({weights[e], {u, targets[e]}});
+            }
+        }
+    }
+    
+    return kruskal(edges, numVertices);
+}
+
+// Kruskal over collected {weight, {u, v}} edges; sorts them in place
+// Time: O(E α(V)) after the O(E) radix sort, Space: O(V)
+vector<pair<pair<int, int>, int>> CSRGraph::kruskal(vector<pair<int, pair<int, int>>>& edges, int numVertices) {
+    vector<pair<pair<int, int>, int>> mst;
+    sortEdges(edges);
+    
+    // Union-Find data structure
+    vector<int> parent(numVertices);
+    vector<int> rank(numVertices, 0);
+    for (int i = 0; i < numVertices; i++) {
+        parent[i] = i;
+    }
+    
+    for (const auto& edge : edges) {
+        int u = edge.second.first;
+        int v = edge.second.second;
+        
+        int uRoot = findParent(parent, u);
+        int vRoot = findParent(parent, v);
+        
+        if (uRoot != vRoot) {
+            mst.push_back({{u, v}, edge.first});
+            unionSets(parent, rank, uRoot, vRoot);
+        }
+    }
+    
+    return mst;
+}
+
+// Cycle Detection using iterative DFS - Time: O(V+E), Space: O(V)
+bool CSRGraph::detectCycle() const {
+    vector<bool> visited(numVertices, false);
+    vector<bool> recStack(numVertices, false);
+    vector<int> stackVertex;
+    vector<int> stackEdge;
+    
+    for (int i = 0; i < numVertices; i++) {
+        if (visited[i]) continue;
+        
+        visited[i] = true;
+        recStack[i] = true;
+        stackVertex.push_back(i);
+        stackEdge.push_back(offsets[i]);
+        
+        while (!stackVertex.empty()) {
+            int v = stackVertex.back();
+            int& e = stackEdge.back();
+            if (e == offsets[v + 1]) {
+                recStack[v] = false;
+                stackVertex.pop_back();
+                stackEdge.pop_back();
+                continue;
+            }
+            
+            int w = targets[e];
+            e++;
+            if (!visited[w]) {
+                visited[w] = true;
+                recStack[w] = true;
+                stackVertex.push_back(w);
+                stackEdge.push_back(offsets[w]);
+            } else if (recStack[w]) {
+                return true;
+            }
+        }
+    }
+    
+    return false;
+}
@@ -0,0 +1,531 @@
+#include "ContractionHierarchy.h"
+#include <fstream>
+
+// Settle limit for witness searches; a cut-off search may add a
+// superfluous shortcut but never loses a shortest path
+static const int WITNESS_SETTLE_LIMIT = 500;
+
+// Node ordering weights: 2 * edge difference + contracted neighbours + level
+static const int EDGE_DIFFERENCE_WEIGHT = 2;
+static const int CONTRACTED_NEIGHBOR_WEIGHT = 1;
+static const int LEVEL_WEIGHT = 1;
+
+// File header for the serialized hierarchy
+static const char CH_MAGIC[4] = {'I', 'T', 'C', 'H'};
+static const int CH_VERSION = 1;
+
+ContractionHierarchy::ContractionHierarchy() : numVertices(0), numShortcuts(0) {
+    upOffsets.push_back(0);
+    downOffsets.push_back(0);
+}
+
+// Inserts from->to, or lowers its weight if the edge already exists
+void ContractionHierarchy::addOrUpdateEdge(vector<vector<CHEdge>>& outEdges, vector<vector<CHEdge>>& inEdges,
+                                           int from, int to, int weight, int middle) {
+    for (size_t i = 0; i < outEdges[from].size(); i++) {
+        if (outEdges[from][i].target == to) {
+            if (weight < outEdges[from][i].weight) {
+                outEdges[from][i].weight = weight;
+                outEdges[from][i].middle = middle;
+                for (size_t j = 0; j < inEdges[to].size(); j++) {
+                    if (inEdges[to][j].target == from) {
+                        inEdges[to][j].weight = weight;
+                        inEdges[to][j].middle = middle;
+                        break;
+                    }
+                }
+            }
+            return;
+        }
+    }
+    outEdges[from].push_back(CHEdge(to, weight, middle));
+    inEdges[to].push_back(CHEdge(from, weight, middle));
+}
+
+// Contracts v (or only counts the shortcuts it would need when simulate is set)
+// For every in-neighbour u a bounded Dijkstra that avoids v looks for a witness
+// path to each out-neighbour w no longer than u->v->w. The search stops once
+// every out-neighbour is settled, the bound is exceeded, or the settle limit hits.
+int ContractionHierarchy::contractVertex(int v, vector<vector<CHEdge>>& outEdges, vector<vector<CHEdge>>& inEdges,
+                                         const vector<bool>& contracted, bool simulate, WitnessWorkspace& witness) {
+    vector<CHEdge> ins = inEdges[v];
+    vector<CHEdge> outs = outEdges[v];
+    int shortcuts = 0;
+    
+    for (size_t i = 0; i < ins.size(); i++) {
+        int u = ins[i].target;
+        if (contracted[u]) continue;
+        
+        int maxDist = 0;
+        int remaining = 0;
+        witness.stamp++;
+        for (size_t j = 0; j < outs.size(); j++) {
+            if (outs[j].target == u) continue;
+            if (ins[i].weight + outs[j].weight > maxDist) {
+                maxDist = ins[i].weight + outs[j].weight;
+            }
+            witness.targetMark[outs[j].target] = witness.stamp;
+            remaining++;
+        }
+        if (remaining == 0) continue;
+        
+        // Witness search from u, skipping v
+        witness.dist[u] = 0;
+        witness.touched.push_back(u);
+        witness.queue.insert(u, 0);
+        int settled = 0;
+        while (!witness.queue.isEmpty()) {
+            int x = witness.queue.extractMin();
+            if (witness.dist[x] > maxDist || ++settled > WITNESS_SETTLE_LIMIT) break;
+            if (witness.targetMark[x] == witness.stamp && --remaining == 0) break;
+            
+            for (size_t k = 0; k < outEdges[x].size(); k++) {
+                int y = outEdges[x][k].target;
+                if (y == v || contracted[y]) continue;
+                int newDist = witness.dist[x] + outEdges[x][k].weight;
+                if (newDist < witness.dist[y]) {
+                    if (witness.dist[y] == INT_MAX) witness.touched.push_back(y);
+                    witness.dist[y] = newDist;
+                    witness.queue.insert(y, newDist);
+                }
+            }
+        }
+        witness.queue.clear();
+        
+        for (size_t j = 0; j < outs.size(); j++) {
+            int w = outs[j].target;
+            if (w == u || contracted[w]) continue;
+            int via = ins[i].weight + outs[j].weight;
+            if (witness.dist[w] > via) {
+                shortcuts++;
+                if (!simulate) {
+                    addOrUpdateEdge(outEdges, inEdges, u, w, via, v);
+                }
+            }
+        }
+        
+        for (size_t k = 0; k < witness.touched.size(); k++) {
+            witness.dist[witness.touched[k]] = INT_MAX;
+        }
+        witness.touched.clear();
+    }
+    
+    return shortcuts;
+}
+
+// Packs per-vertex edge lists into CSR arrays
+void ContractionHierarchy::packEdges(const vector<vector<CHEdge>>& lists, vector<int>& offsets,
+                                     vector<int>& targets, vector<int>& weights, vector<int>& middles) {
+    offsets.assign(lists.size() + 1, 0);
+    for (size_t v = 0; v < lists.size(); v++) {
+        offsets[v + 1] = offsets[v] + lists[v].size();
+    }
+    targets.resize(offsets[lists.size()]);
+    weights.resize(offsets[lists.size()]);
+    middles.resize(offsets[lists.size()]);
+    for (size_t v = 0; v < lists.size(); v++) {
+        int e = offsets[v];
+        for (size_t i = 0; i < lists[v].size(); i++) {
+            targets[e] = lists[v][i].target;
+            weights[e] = lists[v][i].weight;
+            middles[e] = lists[v][i].middle;
+            e++;
+        }
+    }
+}
+
+// Number of edges v still has to uncontracted vertices
+static int liveDegree(int v, const vector<vector<CHEdge>>& outEdges, const vector<vector<CHEdge>>& inEdges) {
+    return outEdges[v].size() + inEdges[v].size();
+}
+
+// Drops every edge that points at v from the given list
+static void removeTarget(vector<CHEdge>& edges, int v) {
+    size_t kept = 0;
+    for (size_t i = 0; i < edges.size(); i++) {
+        if (edges[i].target != v) {
+            edges[kept++] = edges[i];
+        }
+    }
+    edges.resize(kept, CHEdge(-1, 0, -1));
+}
+
+// Build - contracts every vertex and packs the upward/downward graphs
+void ContractionHierarchy::build(const Graph& graph) {
+    CSRGraph csr = graph.freeze();
+    numVertices = csr.getNumVertices();
+    numShortcuts = 0;
+    int n = numVertices;
+    
+    vector<vector<CHEdge>> outEdges(n), inEdges(n);
+    for (int u = 0; u < n; u++) {
+        for (int e = csr.edgeBegin(u); e < csr.edgeEnd(u); e++) {
+            if (csr.edgeTarget(e) != u) {
+                addOrUpdateEdge(outEdges, inEdges, u, csr.edgeTarget(e), csr.edgeWeight(e), -1);
+            }
+        }
+    }
+    
+    vector<bool> contracted(n, false);
+    vector<int> contractedNeighbors(n, 0);
+    vector<int> level(n, 0);
+    WitnessWorkspace witness(n);
+    
+    // Initial order: edge difference only (nothing is contracted yet)
+    IndexedMinHeap order(n);
+    for (int v = 0; v < n; v++) {
+        int shortcuts = contractVertex(v, outEdges, inEdges, contracted, true, witness);
+        order.insert(v, EDGE_DIFFERENCE_WEIGHT * (shortcuts - liveDegree(v, outEdges, inEdges)));
+    }
+    
+    vector<vector<CHEdge>> up(n), down(n);
+    rank.assign(n, -1);
+    int nextRank = 0;
+    
+    while (!order.isEmpty()) {
+        int v = order.extractMin();
+        
+        // Lazy update: re-evaluate and push back if v is no longer the minimum
+        int shortcuts = contractVertex(v, outEdges, inEdges, contracted, true, witness);
+        int priority = EDGE_DIFFERENCE_WEIGHT * (shortcuts - liveDegree(v, outEdges, inEdges)) +
+                       CONTRACTED_NEIGHBOR_WEIGHT * contractedNeighbors[v] + LEVEL_WEIGHT * level[v];
+        if (!order.isEmpty() && priority > order.peekKey()) {
+            order.insert(v, priority);
+            continue;
+        }
+        
+        // All remaining edges of v lead to higher-ranked vertices
+        up[v] = outEdges[v];
+        down[v] = inEdges[v];
+        numShortcuts += contractVertex(v, outEdges, inEdges, contracted, false, witness);
+        contracted[v] = true;
+        rank[v] = nextRank++;
+        
+        vector<int> neighbors;
+        for (size_t i = 0; i < outEdges[v].size(); i++) {
+            int w = outEdges[v][i].target;
+            removeTarget(inEdges[w], v);
+            neighbors.push_back(w);
+        }
+        for (size_t i = 0; i < inEdges[v].size(); i++) {
+            int u = inEdges[v][i].target;
+            removeTarget(outEdges[u], v);
+            neighbors.push_back(u);
+        }
+        vector<CHEdge>().swap(outEdges[v]);
+        vector<CHEdge>().swap(inEdges[v]);
+        
+        // Neighbours pick up the new counts; their keys are refreshed when popped
+        for (size_t i = 0; i < neighbors.size(); i++) {
+            int x = neighbors[i];
+            contractedNeighbors[x]++;
+            if (level[v] + 1 > level[x]) level[x] = level[v] + 1;
+        }
+    }
+    
+    packEdges(up, upOffsets, upTargets, upWeights, upMiddle);
+    packEdges(down, downOffsets, downTargets, downWeights, downMiddle);
+    
+    forwardDist.clear();
+    prepareWorkspace();
+}
+
+// Sizes the query workspaces on first use (or after build/load)
+void ContractionHierarchy::prepareWorkspace() const {
+    if ((int)forwardDist.size() == numVertices) return;
+    forwardDist.assign(numVertices, INT_MAX);
+    backwardDist.assign(numVertices, INT_MAX);
+    forwardParent.assign(numVertices, -1);
+    backwardParent.assign(numVertices, -1);
+    forwardParentEdge.assign(numVertices, -1);
+    backwardParentEdge.assign(numVertices, -1);
+    touched.clear();
+    forwardQueue.reset(numVertices);
+    backwardQueue.reset(numVertices);
+}
+
+// Bidirectional upward search - returns the distance and the meeting vertex
+// Leaves parent links filled in; the caller resets the workspace
+int ContractionHierarchy::search(int src, int dest, int& meet) const {
+    prepareWorkspace();
+    meet = -1;
+    int best = INT_MAX;
+    
+    forwardDist[src] = 0;
+    backwardDist[dest] = 0;
+    touched.push_back(src);
+    touched.push_back(dest);
+    forwardQueue.insert(src, 0);
+    backwardQueue.insert(dest, 0);
+    if (src == dest) {
+        meet = src;
+        best = 0;
+    }
+    
+    while (!forwardQueue.isEmpty() || !backwardQueue.isEmpty()) {
+        int forwardMin = forwardQueue.peekKey();
+        int backwardMin = backwardQueue.peekKey();
+        if (forwardMin >= best && backwardMin >= best) break;
+        
+        bool forward = forwardMin <= backwardMin;
+        IndexedMinHeap& queue = forward ? forwardQueue : backwardQueue;
+        vector<int>& dist = forward ? forwardDist : backwardDist;
+        vector<int>& otherDist = forward ? backwardDist : forwardDist;
+        vector<int>& parent = forward ? forwardParent : backwardParent;
+        vector<int>& parentEdge = forward ? forwardParentEdge : backwardParentEdge;
+        const vector<int>& offsets = forward ? upOffsets : downOffsets;
+        const vector<int>& targets = forward ? upTargets : downTargets;
+        const vector<int>& weights = forward ? upWeights : downWeights;
+        
+        int x = queue.extractMin();
+        for (int e = offsets[x]; e < offsets[x + 1]; e++) {
+            int y = targets[e];
+            int newDist = dist[x] + weights[e];
+            if (newDist < dist[y]) {
+                if (forwardDist[y] == INT_MAX && backwardDist[y] == INT_MAX) touched.push_back(y);
+                dist[y] = newDist;
+                parent[y] = x;
+                parentEdge[y] = e;
+                queue.insert(y, newDist);
+                if (otherDist[y] != INT_MAX && newDist + otherDist[y] < best) {
+                    best = newDist + otherDist[y];
+                    meet = y;
+                }
+            }
+        }
+    }
+    
+    return best;
+}
+
+// Finds the edge to 'target' in the CSR list of 'at'
+int ContractionHierarchy::findEdge(const vector<int>& offsets, const vector<int>& targets, int at, int target) const {
+    for (int e = offsets[at]; e < offsets[at + 1]; e++) {
+        if (targets[e] == target) return e;
+    }
+    return -1;
+}
+
+// Expands from->to into original routes, appending every vertex after 'from'
+// A shortcut a->b via m is split into a->m (stored reversed at m in the
+// downward graph) and m->b (stored at m in the upward graph); explicit stack.
+void ContractionHierarchy::unpackEdge(int from, int to, int middle, vector<int>& path) const {
+    vector<int> stackFrom, stackTo, stackMiddle;
+    stackFrom.push_back(from);
+    stackTo.push_back(to);
+    stackMiddle.push_back(middle);
+    
+    while (!stackFrom.empty()) {
+        int a = stackFrom.back();
+        int b = stackTo.back();
+        int m = stackMiddle.back();
+        stackFrom.pop_back();
+        stackTo.pop_back();
+        stackMiddle.pop_back();
+        
+        if (m == -1) {
+            path.push_back(b);
+            continue;
+        }
+        
+        int first = findEdge(downOffsets, downTargets, m, a);
+        int second = findEdge(upOffsets, upTargets, m, b);
+        // Second half pushed first so a->m is expanded first
+        stackFrom.push_back(m);
+        stackTo.push_back(b);
+        stackMiddle.push_back(upMiddle[second]);
+        stackFrom.push_back(a);
+        stackTo.push_back(m);
+        stackMiddle.push_back(downMiddle[first]);
+    }
+}
+
+// Distance query - Time: typically a few hundred settled vertices
+int ContractionHierarchy::distance(int src, int dest) const {
+    if (src < 0 || dest < 0 || src >= numVertices || dest >= numVertices) return INT_MAX;
+    
+    int meet;
+    int best = search(src, dest, meet);
+    
+    for (size_t i = 0; i < touched.size(); i++) {
+        forwardDist[touched[i]] = INT_MAX;
+        backwardDist[touched[i]] = INT_MAX;
+    }
+    touched.clear();
+    forwardQueue.clear();
+    backwardQueue.clear();
+    return best;
+}
+
+// Path query - unpacks shortcuts into the original station sequence
+// Among several equally short paths the one returned may differ from
+// Graph::shortestPath, but its length is always the same.
+vector<int> ContractionHierarchy::shortestPath(int src, int dest, int* distance) const {
+    vector<int> path;
+    if (distance) *distance = INT_MAX;
+    if (src < 0 || dest < 0 || src >= numVertices || dest >= numVertices) return path;
+    
+    int meet;
+    int best = search(src, dest, meet);
+    
+    if (best != INT_MAX) {
+        if (distance) *distance = best;
+        
+        // Forward half: collect upward edges from meet back to src
+        vector<int> chain;
+        for (int x = meet; x != src; x = forwardParent[x]) {
+            chain.push_back(forwardParentEdge[x]);
+        }
+        path.push_back(src);
+        for (int i = (int)chain.size() - 1; i >= 0; i--) {
+            int e = chain[i];
+            unpackEdge(path.back(), upTargets[e], upMiddle[e], path);
+        }
+        
+        // Backward half: each downward edge leads from x towards dest
+        for (int x = meet; x != dest; x = backwardParent[x]) {
+            int e = backwardParentEdge[x];
+            unpackEdge(x, backwardParent[x], downMiddle[e], path);
+        }
+    }
+    
+    for (size_t i = 0; i < touched.size(); i++) {
+        forwardDist[touched[i]] = INT_MAX;
+        backwardDist[touched[i]] = INT_MAX;
+    }
+    touched.clear();
+    forwardQueue.clear();
+    backwardQueue.clear();
+    return path;
+}
+
+// Serialization helpers
+static void writeArray(ofstream& out, const vector<int>& data) {
+    int size = data.size();
+    out.write(reinterpret_cast<const char*>(&size), sizeof(int));
+    if (size > 0) {
+        out.write(reinterpret_cast<const char*>(&data[0]), sizeof(int) * size);
+    }
+}
+
+// The length field is checked against the bytes left in the file before
+// allocating, so a corrupted length is rejected instead of allocated
+static bool readArray(ifstream& in, vector<int>& data) {
+    int size = 0;
+    if (!in.read(reinterpret_cast<char*>(&size), sizeof(int)) || size < 0) return false;
+    streampos arrayStart = in.tellg();
+    in.seekg(0, ios::end);
+    long long remaining = (long long)(in.tellg() - arrayStart);
+    in.seekg(arrayStart);
+    if ((long long)sizeof(int) * size > remaining) return false;
+    data.resize(size);
+    if (size > 0 && !in.read(reinterpret_cast<char*>(&data[0]), sizeof(int) * size)) return false;
+    return true;
+}
+
+// Save - layout: magic, version, V, shortcut count, then each array as (size, ints)
+bool ContractionHierarchy::save(const string& filename) const {
+    ofstream out(filename.c_str(), ios::binary);
+    if (!out) return false;
+    
+    out.write(CH_MAGIC, 4);
+    out.write(reinterpret_cast<const char*>(&CH_VERSION), sizeof(int));
+    out.write(reinterpret_cast<const char*>(&numVertices), sizeof(int));
+    out.write(reinterpret_cast<const char*>(&numShortcuts), sizeof(int));
+    writeArray(out, rank);
+    writeArray(out, upOffsets);
+    writeArray(out, upTargets);
+    writeArray(out, upWeights);
+    writeArray(out, upMiddle);
+    writeArray(out, downOffsets);
+    writeArray(out, downTargets);
+    writeArray(out, downWeights);
+    writeArray(out, downMiddle);
+    return out.good();
+}
+
+// Check Edges - one direction of the hierarchy (array sizes already checked)
+// Every edge must lead to a higher rank, and every shortcut's middle vertex must
+// rank below both ends and own the two half-edges unpackEdge looks up; middle
+// ranks then fall strictly as shortcuts unpack, so unpacking terminates
+// Time: O(E * degree), Space: O(1)
+bool ContractionHierarchy::checkEdges(const vector<int>& offsets, const vector<int>& targets,
+                                      const vector<int>& middles, bool upward) const {
+    if (offsets[0] != 0) return false;
+    for (int u = 0; u < numVertices; u++) {
+        if (offsets[u] > offsets[u + 1]) return false;
+        for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+            int v = targets[e];
+            if (v < 0 || v >= numVertices || rank[v] <= rank[u]) return false;
+            int m = middles[e];
+            if (m == -1) continue;
+            if (m < 0 || m >= numVertices || rank[m] >= rank[u]) return false;
+            // Upward u->v unpacks as u->m, m->v; downward v->u as v->m, m->u
+            int from = upward ? u : v, to = upward ? v : u;
+            if (findEdge(downOffsets, downTargets, m, from) == -1 ||
+                findEdge(upOffsets, upTargets, m, to) == -1) return false;
+        }
+    }
+    return true;
+}
+
+// Check Structure - rank must be a permutation, then both edge directions
+// Time: O(V + E * degree), Space: O(V)
+bool ContractionHierarchy::checkStructure() const {
+    vector<bool> seen(numVertices, false);
+    for (int v = 0; v < numVertices; v++) {
+        if (rank[v] < 0 || rank[v] >= numVertices || seen[rank[v]]) return false;
+        seen[rank[v]] = true;
+    }
+    return checkEdges(upOffsets, upTargets, upMiddle, true) &&
+           checkEdges(downOffsets, downTargets, downMiddle, false);
+}
+
+// Load - rejects files with a wrong header, inconsistent array sizes or a
+// structure the queries could not follow
+bool ContractionHierarchy::load(const string& filename) {
+    ifstream in(filename.c_str(), ios::binary);
+    if (!in) return false;
+    
+    char magic[4];
+    int version = 0, vertices = 0, shortcuts = 0;
+    if (!in.read(magic, 4) || magic[0] != CH_MAGIC[0] || magic[1] != CH_MAGIC[1] ||
+        magic[2] != CH_MAGIC[2] || magic[3] != CH_MAGIC[3]) return false;
+    if (!in.read(reinterpret_cast<char*>(&version), sizeof(int)) || version != CH_VERSION) return false;
+    if (!in.read(reinterpret_cast<char*>(&vertices), sizeof(int)) || vertices < 0) return false;
+    if (!in.read(reinterpret_cast<char*>(&shortcuts), sizeof(int))) return false;
+    
+    ContractionHierarchy loaded;
+    if (!readArray(in, loaded.rank) || !readArray(in, loaded.upOffsets) ||
+        !readArray(in, loaded.upTargets) || !readArray(in, loaded.upWeights) ||
+        !readArray(in, loaded.upMiddle) || !readArray(in, loaded.downOffsets) ||
+        !readArray(in, loaded.downTargets) || !readArray(in, loaded.downWeights) ||
+        !readArray(in, loaded.downMiddle)) return false;
+    
+    int upCount = loaded.upTargets.size();
+    int downCount = loaded.downTargets.size();
+    if ((int)loaded.rank.size() != vertices ||
+        (int)loaded.upOffsets.size() != vertices + 1 || loaded.upOffsets[vertices] != upCount ||
+        (int)loaded.downOffsets.size() != vertices + 1 || loaded.downOffsets[vertices] != downCount ||
+        (int)loaded.upWeights.size() != upCount || (int)loaded.upMiddle.size() != upCount ||
+        (int)loaded.downWeights.size() != downCount || (int)loaded.downMiddle.size() != downCount) {
+        return false;
+    }
+    loaded.numVertices = vertices;
+    if (!loaded.checkStructure()) return false;
+    
+    numVertices = vertices;
+    numShortcuts = shortcuts;
+    rank.swap(loaded.rank);
+    upOffsets.swap(loaded.upOffsets);
+    upTargets.swap(loaded.upTargets);
+    upWeights.swap(loaded.upWeights);
+    upMiddle.swap(loaded.upMiddle);
+    downOffsets.swap(loaded.downOffsets);
+    downTargets.swap(loaded.downTargets);
+    downWeights.swap(loaded.downWeights);
+    downMiddle.swap(loaded.downMiddle);
+    forwardDist.clear();
+    prepareWorkspace();
+    return true;
+}
@@ -1,67 +1,150 @@
 #include "Graph.h"
+#include "Heuristic.h"
+#include "ThreadPool.h"
+#include "Logger.h"
 #include <iostream>
+#include <chrono>
+#include <atomic>
 
-Graph::Graph(int V) : numVertices(V) {
+const int Graph::MAX_STATION_ID;
+
+Graph::Graph(int V) : numVertices(V), repairStamp(0), lastRepairCount(0), visitStamp(0) {
+    if (V < 0 || V > MAX_STATION_ID + 1) {
+        LOG_ERROR("Invalid number of stations!");
+        numVertices = V < 0 ? 0 : MAX_STATION_ID + 1;
+        V = numVertices;
+    }
     adjList.resize(V);
-    adjMatrix.resize(V, vector<int>(V, 0));
-    // EdgeList objects are default constructed (head = nullptr)
+    reverseAdjList.resize(V);
+    stationIndex.resize(V, -1);
+    // EdgeList objects are default constructed (head = tail = nullptr)
+}
+
+// Station index lookup - Time: O(1), Space: O(1)
+int Graph::findStationSlot(int id) const {
+    if (id < 0 || id >= numVertices) return -1;
+    return stationIndex[id];
 }
 
+// Add Station - Time: O(1) amortized, Space: O(1)
 void Graph::addStation(int id, const string& name) {
-    // Check if station already exists
-    for (const auto& station : stations) {
-        if (station.id == id) {
-            cout << "Station with ID " << id << " already exists!" << endl;
-            return;
-        }
+    if (id < 0 || id > MAX_STATION_ID) {
+        LOG_ERROR("Invalid station ID!");
+        return;
     }
     
-    stations.push_back(Station(id, name));
+    // Check if station already exists
+    if (findStationSlot(id) != -1) {
+        LOG_WARNING("Station with ID " << id << " already exists!");
+        return;
+    }
     
     // Expand graph if needed
     if (id >= numVertices) {
         numVertices = id + 1;
         adjList.resize(numVertices);
-        adjMatrix.resize(numVertices);
-        for (int i = 0; i < numVertices; i++) {
-            adjMatrix[i].resize(numVertices, 0);
+        reverseAdjList.resize(numVertices);
+        stationIndex.resize(numVertices, -1);
+        for (size_t h = 0; h < hubTrees.size(); h++) {
+            hubTrees[h].dist.resize(numVertices, INT_MAX);
+            hubTrees[h].parent.resize(numVertices, -1);
+        }
+    }
+    
+    stations.push_back(Station(id, name));
+    stationIndex[id] = stations.size() - 1;
+    
+    LOG_INFO("Station '" << name << "' (ID: " << id << ") added successfully!");
+}
+
+// Add Station with coordinates (read by the geometric A* heuristics)
+void Graph::addStation(int id, const string& name, double x, double y) {
+    bool existed = stationExists(id);
+    addStation(id, name);
+    
+    Station* station = getStation(id);
+    if (!existed && station != nullptr) {
+        station->x = x;
+        station->y = y;
+        station->hasCoordinates = true;
+    }
+}
+
+// Bulk stations - grows the lists once for the largest ID in the batch
+int Graph::addStations(const vector<Station>& batch) {
+    int maxId = numVertices - 1;
+    for (size_t i = 0; i < batch.size(); i++) {
+        if (batch[i].id > maxId && batch[i].id <= MAX_STATION_ID) maxId = batch[i].id;
+    }
+    if (maxId >= numVertices) {
+        numVertices = maxId + 1;
+        adjList.resize(numVertices);
+        reverseAdjList.resize(numVertices);
+        stationIndex.resize(numVertices, -1);
+        for (size_t h = 0; h < hubTrees.size(); h++) {
+            hubTrees[h].dist.resize(numVertices, INT_MAX);
+            hubTrees[h].parent.resize(numVertices, -1);
         }
     }
     
-    cout << "Station '" << name << "' (ID: " << id << ") added successfully!" << endl;
+    stations.reserve(stations.size() + batch.size());
+    int added = 0;
+    for (size_t i = 0; i < batch.size(); i++) {
+        int id = batch[i].id;
+        if (id < 0 || id > MAX_STATION_ID || stationIndex[id] != -1) continue;
+        stations.push_back(batch[i]);
+        stationIndex[id] = stations.size() - 1;
+        added++;
+    }
+    return added;
 }
 
 void Graph::deleteStation(int id) {
-    // Remove station from list manually (no std::remove_if)
-    for (auto it = stations.begin(); it != stations.end(); ) {
-        if (it->id == id) {
-            it = stations.erase(it);
-        } else {
-            ++it;
+    // Remove station from list, keeping insertion order, and re-index the shifted tail
+    int slot = findStationSlot(id);
+    if (slot != -1) {
+        stations.erase(stations.begin() + slot);
+        stationIndex[id] = -1;
+        for (int i = slot; i < static_cast<int>(stations.size()); i++) {
+            stationIndex[stations[i].id] = i;
         }
     }
     
-    if (id < numVertices) {
+    if (id >= 0 && id < numVertices) {
         // Remove all edges connected to this station manually
-        adjList[id].clear();
-        for (int i = 0; i < numVertices; i++) {
-        // Manual removal from list
-        adjList[i].remove(id);
-            adjMatrix[i][id] = 0;
-            adjMatrix[id][i] = 0;
+        // Time: O(sum of neighbour degrees), only lists that mention id are touched
+        Edge* current = adjList[id].begin();
+        while (current != nullptr) {
+            if (current->destination != id) {
+                reverseAdjList[current->destination].remove(reverseEdgePool, id);
+            }
+            current = current->next;
+        }
+        current = reverseAdjList[id].begin();
+        while (current != nullptr) {
+            if (current->destination != id) {
+                adjList[current->destination].remove(edgePool, id);
+            }
+            current = current->next;
+        }
+        adjList[id].clear(edgePool);
+        reverseAdjList[id].clear(reverseEdgePool);
+        
+        // Many routes vanish at once, so hub trees are rebuilt rather than repaired
+        removeHub(id);
+        for (size_t h = 0; h < hubTrees.size(); h++) {
+            buildHubTree(hubTrees[h]);
         }
     }
     
-    cout << "Station with ID " << id << " deleted successfully!" << endl;
+    LOG_INFO("Station with ID " << id << " deleted successfully!");
 }
 
+// Get Station - Time: O(1), Space: O(1)
 Station* Graph::getStation(int id) {
-    for (auto& station : stations) {
-        if (station.id == id) {
-            return &station;
-        }
-    }
-    return nullptr;
+    int slot = findStationSlot(id);
+    if (slot == -1) return nullptr;
+    return &stations[slot];
 }
 
 vector<Station> Graph::getAllStations() const {
@@ -70,7 +153,7 @@ vector<Station> Graph::getAllStations() const {
 
 void Graph::addRoute(int src, int dest, int weight) {
     if (src >= numVertices || dest >= numVertices) {
-        cout << "Invalid station IDs!" << endl;
+        LOG_ERROR("Invalid station IDs!");
         return;
     }
     
@@ -78,45 +161,151 @@ void Graph::addRoute(int src, int dest, int weight) {
     Edge* current = adjList[src].begin();
     while (current != nullptr) {
         if (current->destination == dest) {
-            cout << "Route already exists! Updating weight..." << endl;
+            LOG_INFO("Route already exists! Updating weight...");
+            int oldWeight = current->weight;
             current->weight = weight;
-            adjMatrix[src][dest] = weight;
+            Edge* incoming = reverseAdjList[dest].begin();
+            while (incoming != nullptr && incoming->destination != src) {
+                incoming = incoming->next;
+            }
+            if (incoming != nullptr) incoming->weight = weight;
+            onRouteChanged(src, dest, oldWeight, weight);
             return;
         }
         current = current->next;
     }
     
-    adjList[src].push_back(dest, weight);
-    adjMatrix[src][dest] = weight;
-    cout << "Route added from station " << src << " to " << dest << " with weight " << weight << endl;
+    adjList[src].push_back(edgePool, dest, weight);
+    reverseAdjList[dest].push_back(reverseEdgePool, src, weight);
+    onRouteChanged(src, dest, -1, weight);
+    LOG_INFO("Route added from station " << src << " to " << dest << " with weight " << weight);
+}
+
+// Bulk routes - same update rule as addRoute, no output
+int Graph::addRoutes(const vector<RouteRecord>& batch) {
+    int accepted = 0;
+    bool changed = false;
+    for (size_t i = 0; i < batch.size(); i++) {
+        int src = batch[i].src;
+        int dest = batch[i].dest;
+        int weight = batch[i].weight;
+        if (findStationSlot(src) == -1 || findStationSlot(dest) == -1) continue;  // Also rejects out-of-range IDs
+        accepted++;
+        
+        Edge* current = adjList[src].begin();
+        while (current != nullptr && current->destination != dest) {
+            current = current->next;
+        }
+        if (current != nullptr) {
+            if (current->weight == weight) continue;
+            current->weight = weight;
+            Edge* incoming = reverseAdjList[dest].begin();
+            while (incoming != nullptr && incoming->destination != src) {
+                incoming = incoming->next;
+            }
+            if (incoming != nullptr) incoming->weight = weight;
+        } else {
+            adjList[src].push_back(edgePool, dest, weight);
+            reverseAdjList[dest].push_back(reverseEdgePool, src, weight);
+        }
+        changed = true;
+    }
+    
+    // One Dijkstra per hub instead of a repair per route
+    lastRepairCount = 0;
+    if (changed) {
+        for (size_t h = 0; h < hubTrees.size(); h++) {
+            buildHubTree(hubTrees[h]);
+        }
+    }
+    return accepted;
 }
 
 void Graph::deleteRoute(int src, int dest) {
     if (src >= numVertices || dest >= numVertices) {
-        cout << "Invalid station IDs!" << endl;
+        LOG_ERROR("Invalid station IDs!");
         return;
     }
     
     // Manual removal from list
-    adjList[src].remove(dest);
-    adjMatrix[src][dest] = 0;
-    cout << "Route from station " << src << " to " << dest << " deleted!" << endl;
+    int oldWeight = getRouteWeight(src, dest);
+    adjList[src].remove(edgePool, dest);
+    reverseAdjList[dest].remove(reverseEdgePool, src);
+    if (oldWeight != -1) onRouteChanged(src, dest, oldWeight, -1);
+    LOG_INFO("Route from station " << src << " to " << dest << " deleted!");
+}
+
+// Route weight lookup - Time: O(out-degree of src), Space: O(1)
+int Graph::getRouteWeight(int src, int dest) const {
+    if (src < 0 || src >= numVertices) return -1;
+    
+    Edge* current = adjList[src].begin();
+    while (current != nullptr) {
+        if (current->destination == dest) {
+            return current->weight;
+        }
+        current = current->next;
+    }
+    return -1;
+}
+
+// Register a travel-time profile - Time: O(points), Space: O(points) unless shared
+int Graph::addTravelTimeProfile(const vector<int>& times, const vector<int>& travelTimes) {
+    return profiles.addProfile(times, travelTimes);
+}
+
+// Attach a profile to an existing route - Time: O(out-degree of src), Space: O(1)
+bool Graph::setRouteProfile(int src, int dest, int profileId) {
+    if (src < 0 || src >= numVertices) {
+        LOG_ERROR("Invalid station IDs!");
+        return false;
+    }
+    if (profileId < -1 || profileId >= profiles.getNumProfiles()) {
+        LOG_ERROR("Invalid travel-time profile!");
+        return false;
+    }
+    
+    Edge* current = adjList[src].begin();
+    while (current != nullptr) {
+        if (current->destination == dest) {
+            current->profile = profileId;
+            return true;
+        }
+        current = current->next;
+    }
+    LOG_WARNING("Route from station " << src << " to " << dest << " does not exist!");
+    return false;
+}
+
+// Travel time of one route when entering it at departureTime
+// Time: O(out-degree of src + log points), Space: O(1)
+int Graph::getRouteTravelTime(int src, int dest, int departureTime) const {
+    if (src < 0 || src >= numVertices) return -1;
+    
+    Edge* current = adjList[src].begin();
+    while (current != nullptr) {
+        if (current->destination == dest) {
+            return current->profile == -1 ? current->weight : profiles.evaluate(current->profile, departureTime);
+        }
+        current = current->next;
+    }
+    return -1;
 }
 
 void Graph::displayAllStations() {
-    cout << "\n=== All Stations ===" << endl;
+    cout << "\n=== All Stations ===\n";
     if (stations.empty()) {
-        cout << "No stations available." << endl;
+        cout << "No stations available.\n";
         return;
     }
     
     for (const auto& station : stations) {
-        cout << "ID: " << station.id << " | Name: " << station.name << endl;
+        cout << "ID: " << station.id << " | Name: " << station.name << '\n';
     }
 }
 
 void Graph::displayConnections() {
-    cout << "\n=== Station Connections ===" << endl;
+    cout << "\n=== Station Connections ===\n";
     for (int i = 0; i < numVertices; i++) {
         if (!adjList[i].empty()) {
             Station* station = getStation(i);
@@ -129,23 +318,7 @@ void Graph::displayConnections() {
                          << ", weight: " << current->weight << ") ";
                     current = current->next;
                 }
-                cout << endl;
-            }
-        }
-    }
-}
-
-// Manual sorting for MST edges - Bubble Sort implementation
-// Time: O(E²), Space: O(1)
-void Graph::sortEdges(vector<pair<int, pair<int, int>>>& edges) {
-    int n = edges.size();
-    for (int i = 0; i < n - 1; i++) {
-        for (int j = 0; j < n - i - 1; j++) {
-            if (edges[j].first > edges[j + 1].first) {
-                // Swap edges
-                pair<int, pair<int, int>> temp = edges[j];
-                edges[j] = edges[j + 1];
-                edges[j + 1] = temp;
+                cout << '\n';
             }
         }
     }
@@ -180,32 +353,419 @@ vector<int> Graph::BFS(int startVertex) {
     return result;
 }
 
+// Starts a traversal: O(1) unless the station range grew or the stamp wrapped
+void Graph::beginTraversal() {
+    if ((int)visitMark.size() != numVertices || visitStamp > INT_MAX - 4) {
+        visitMark.assign(numVertices, 0);
+        visitStamp = 0;
+    }
+    visitStamp += 2;
+    stackVertex.clear();
+    stackEdge.clear();
+}
+
 // DFS Implementation - Time: O(V+E), Space: O(V)
-void Graph::DFSUtil(int v, vector<bool>& visited, vector<int>& result) {
-    visited[v] = true;
+// Explicit stack of (station, next route) reproduces the recursive visit
+// order without growing the call stack on long corridors
+void Graph::DFSUtil(int v, vector<int>& result) {
+    visitMark[v] = visitStamp;
     result.push_back(v);
+    stackVertex.push_back(v);
+    stackEdge.push_back(adjList[v].begin());
     
-    Edge* current = adjList[v].begin();
-    while (current != nullptr) {
-        if (!visited[current->destination]) {
-            DFSUtil(current->destination, visited, result);
+    while (!stackVertex.empty()) {
+        Edge*& current = stackEdge.back();
+        if (current == nullptr) {
+            stackVertex.pop_back();
+            stackEdge.pop_back();
+            continue;
         }
+        
+        int w = current->destination;
         current = current->next;
+        if (visitMark[w] < visitStamp) {
+            visitMark[w] = visitStamp;
+            result.push_back(w);
+            stackVertex.push_back(w);
+            stackEdge.push_back(adjList[w].begin());
+        }
     }
 }
 
 vector<int> Graph::DFS(int startVertex) {
     vector<int> result;
-    if (startVertex >= numVertices) return result;
+    if (startVertex < 0 || startVertex >= numVertices) return result;
     
-    vector<bool> visited(numVertices, false);
-    DFSUtil(startVertex, visited, result);
+    beginTraversal();
+    DFSUtil(startVertex, result);
     
     return result;
 }
 
-// Dijkstra's Algorithm - Time: O(V^2) with adjacency matrix, Space: O(V)
-vector<int> Graph::shortestPath(int src, int dest) {
+// Direction-Optimizing BFS (Beamer et al.) - Time: O(V+E), Space: O(V)
+// Top-down steps scan the frontier's outgoing routes and claim unvisited
+// stations with an atomic fetch_or on the visited bitmap. Once the frontier's
+// routes outnumber those left to explore / ALPHA, bottom-up steps instead let
+// every unvisited station look for a parent among its incoming routes and stop
+// at the first hit; when the frontier shrinks below V / BETA it switches back.
+vector<int> Graph::parallelBFS(int startVertex, vector<int>* levels, int threads, int* bottomUpLevels) const {
+    const int ALPHA = 14;
+    const int BETA = 24;
+    const int TOP_DOWN_CHUNK = 256;     // Frontier stations per task
+    const int BOTTOM_UP_CHUNK = 4096;   // Stations per task (a multiple of 64: whole bitmap words)
+    
+    vector<int> order;
+    vector<int> localLevels;
+    vector<int>& depth = (levels != nullptr) ? *levels : localLevels;
+    depth.assign(numVertices, -1);
+    if (bottomUpLevels != nullptr) *bottomUpLevels = 0;
+    if (startVertex < 0 || startVertex >= numVertices) return order;
+    
+    int words = (numVertices + 63) / 64;
+    vector<atomic<unsigned long long>> visited(words);
+    for (int i = 0; i < words; i++) visited[i].store(0, memory_order_relaxed);
+    vector<unsigned long long> frontierBits(words, 0);
+    
+    ThreadPool pool(threads);
+    vector<vector<int>> chunkOut;
+    vector<long long> chunkEdges;
+    vector<int> frontier(1, startVertex);
+    
+    visited[startVertex >> 6].store(1ULL << (startVertex & 63), memory_order_relaxed);
+    depth[startVertex] = 0;
+    order.push_back(startVertex);
+    long long unexploredEdges = edgePool.getLiveCount() - adjList[startVertex].size();
+    long long frontierEdges = adjList[startVertex].size();
+    bool bottomUp = false;
+    
+    for (int level = 0; !frontier.empty(); level++) {
+        if (!bottomUp && frontierEdges > unexploredEdges / ALPHA) {
+            bottomUp = true;
+        } else if (bottomUp && (long long)frontier.size() * BETA < numVertices) {
+            bottomUp = false;
+        }
+        
+        int chunks;
+        if (bottomUp) {
+            if (bottomUpLevels != nullptr) (*bottomUpLevels)++;
+            for (size_t i = 0; i < frontier.size(); i++) {
+                frontierBits[frontier[i] >> 6] |= 1ULL << (frontier[i] & 63);
+            }
+            chunks = (numVertices + BOTTOM_UP_CHUNK - 1) / BOTTOM_UP_CHUNK;
+        } else {
+            chunks = (frontier.size() + TOP_DOWN_CHUNK - 1) / TOP_DOWN_CHUNK;
+        }
+        if ((int)chunkOut.size() < chunks) {
+            chunkOut.resize(chunks);
+            chunkEdges.resize(chunks);
+        }
+        
+        pool.parallelFor(chunks, [&](int chunk, int) {
+            vector<int>& out = chunkOut[chunk];
+            out.clear();
+            long long edges = 0;
+            if (bottomUp) {
+                int first = chunk * BOTTOM_UP_CHUNK;
+                int last = (first + BOTTOM_UP_CHUNK < numVertices) ? first + BOTTOM_UP_CHUNK : numVertices;
+                for (int v = first; v < last; v++) {
+                    unsigned long long bit = 1ULL << (v & 63);
+                    if (visited[v >> 6].load(memory_order_relaxed) & bit) continue;
+                    Edge* incoming = reverseAdjList[v].begin();
+                    while (incoming != nullptr) {
+                        int u = incoming->destination;
+                        if (frontierBits[u >> 6] & (1ULL << (u & 63))) {
+                            visited[v >> 6].fetch_or(bit, memory_order_relaxed);
+                            depth[v] = level + 1;
+                            out.push_back(v);
+                            edges += adjList[v].size();
+                            break;
+                        }
+                        incoming = incoming->next;
+                    }
+                }
+            } else {
+                int first = chunk * TOP_DOWN_CHUNK;
+                int last = (first + TOP_DOWN_CHUNK < (int)frontier.size()) ? first + TOP_DOWN_CHUNK : frontier.size();
+                for (int i = first; i < last; i++) {
+                    Edge* current = adjList[frontier[i]].begin();
+                    while (current != nullptr) {
+                        int v = current->destination;
+                        unsigned long long bit = 1ULL << (v & 63);
+                        // Plain load first: most targets are already visited
+                        if (!(visited[v >> 6].load(memory_order_relaxed) & bit) &&
+                            !(visited[v >> 6].fetch_or(bit, memory_order_relaxed) & bit)) {
+                            depth[v] = level + 1;
+                            out.push_back(v);
+                            edges += adjList[v].size();
+                        }
+                        current = current->next;
+                    }
+                }
+            }
+            chunkEdges[chunk] = edges;
+        });
+        
+        if (bottomUp) {
+            for (size_t i = 0; i < frontier.size(); i++) {
+                frontierBits[frontier[i] >> 6] = 0;
+            }
+        }
+        
+        frontier.clear();
+        frontierEdges = 0;
+        for (int c = 0; c < chunks; c++) {
+            for (size_t i = 0; i < chunkOut[c].size(); i++) {
+                frontier.push_back(chunkOut[c][i]);
+                order.push_back(chunkOut[c][i]);
+            }
+            frontierEdges += chunkEdges[c];
+        }
+        unexploredEdges -= frontierEdges;
+    }
+    
+    return order;
+}
+
+// Dijkstra's Algorithm - Time: O((V+E) log V) with indexed min-heap, Space: O(V)
+// Vertices are settled in the same (distance, ID) order as the linear scan below,
+// so the returned path is identical; the search stops once dest is settled.
+vector<int> Graph::shortestPath(int src, int dest, SearchStats* stats) {
+    vector<int> path;
+    if (stats) *stats = SearchStats();
+    if (src < 0 || dest < 0 || src >= numVertices || dest >= numVertices) return path;
+    
+    auto start = chrono::high_resolution_clock::now();
+    vector<int> dist(numVertices, INT_MAX);
+    vector<int> parent(numVertices, -1);
+    vector<bool> visited(numVertices, false);
+    IndexedMinHeap pq(numVertices);
+    int settled = 0;
+    
+    dist[src] = 0;
+    pq.insert(src, 0);
+    
+    while (!pq.isEmpty()) {
+        int u = pq.extractMin();
+        visited[u] = true;
+        settled++;
+        if (u == dest) break;
+        
+        // Update distances
+        Edge* current = adjList[u].begin();
+        while (current != nullptr) {
+            int v = current->destination;
+            int weight = current->weight;
+            
+            if (!visited[v] && dist[u] + weight < dist[v]) {
+                dist[v] = dist[u] + weight;
+                parent[v] = u;
+                pq.insert(v, dist[v]);
+            }
+            current = current->next;
+        }
+    }
+    
+    if (stats) {
+        stats->settledNodes = settled;
+        stats->distance = dist[dest];
+        stats->elapsedMs = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+    }
+    
+    if (dist[dest] == INT_MAX) {
+        LOG_INFO("No path exists from station " << src << " to " << dest);
+        return path;
+    }
+    
+    path = CSRGraph::buildPath(parent, dest);
+    LOG_INFO("Shortest distance from station " << src << " to " << dest << ": " << dist[dest]);
+    return path;
+}
+
+// Bidirectional Dijkstra - Time: O((V+E) log V) worst case, Space: O(V)
+// A forward search from src over adjList and a backward search from dest over
+// reverseAdjList run alternately (the side with the smaller queue key goes next).
+// Every relaxed edge that reaches a vertex already labelled by the other side is
+// a candidate meeting point; the search stops once the two queue minima add up
+// to at least the best candidate. On typical queries each side only explores a
+// ball of about half the radius, roughly halving the settled vertices.
+// Distances always match shortestPath; among equal-length paths a different
+// one may be returned. Does not print.
+vector<int> Graph::shortestPathBidirectional(int src, int dest, SearchStats* stats) {
+    vector<int> path;
+    if (stats) *stats = SearchStats();
+    if (src < 0 || dest < 0 || src >= numVertices || dest >= numVertices) return path;
+    
+    auto start = chrono::high_resolution_clock::now();
+    vector<int> forwardDist(numVertices, INT_MAX), backwardDist(numVertices, INT_MAX);
+    vector<int> forwardParent(numVertices, -1), backwardParent(numVertices, -1);
+    IndexedMinHeap forwardQueue(numVertices), backwardQueue(numVertices);
+    int settled = 0;
+    int best = INT_MAX;
+    int meet = -1;
+    
+    forwardDist[src] = 0;
+    backwardDist[dest] = 0;
+    forwardQueue.insert(src, 0);
+    backwardQueue.insert(dest, 0);
+    if (src == dest) {
+        best = 0;
+        meet = src;
+    }
+    
+    while (!forwardQueue.isEmpty() && !backwardQueue.isEmpty()) {
+        int forwardMin = forwardQueue.peekKey();
+        int backwardMin = backwardQueue.peekKey();
+        if (best != INT_MAX && (long long)forwardMin + backwardMin >= best) break;
+        
+        bool forward = forwardMin <= backwardMin;
+        IndexedMinHeap& queue = forward ? forwardQueue : backwardQueue;
+        vector<int>& dist = forward ? forwardDist : backwardDist;
+        vector<int>& parent = forward ? forwardParent : backwardParent;
+        const vector<int>& otherDist = forward ? backwardDist : forwardDist;
+        const vector<EdgeList>& lists = forward ? adjList : reverseAdjList;
+        
+        int u = queue.extractMin();
+        settled++;
+        
+        Edge* current = lists[u].begin();
+        while (current != nullptr) {
+            int v = current->destination;
+            int newDist = dist[u] + current->weight;
+            
+            if (newDist < dist[v]) {
+                dist[v] = newDist;
+                parent[v] = u;
+                queue.insert(v, newDist);
+            }
+            if (otherDist[v] != INT_MAX && (long long)dist[v] + otherDist[v] < best) {
+                best = dist[v] + otherDist[v];
+                meet = v;
+            }
+            current = current->next;
+        }
+    }
+    
+    if (stats) {
+        stats->settledNodes = settled;
+        stats->distance = best;
+        stats->elapsedMs = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+    }
+    
+    if (best == INT_MAX) return path;
+    
+    // src ... meet from the forward tree, then meet ... dest from the backward tree
+    path = CSRGraph::buildPath(forwardParent, meet);
+    int current = backwardParent[meet];
+    while (current != -1) {
+        path.push_back(current);
+        current = backwardParent[current];
+    }
+    return path;
+}
+
+// Time-dependent Dijkstra - Time: O((V+E) (log V + log points)), Space: O(V)
+// Labels are arrival times: leaving u at arrival[u] over an edge costs its
+// profile evaluated at that moment (or its static weight). Every profile is
+// FIFO, so the earliest arrival at u is always the best moment to leave it
+// and the usual settle-once Dijkstra stays exact without waiting at stations.
+// stats->distance is the travel time (arrival - departureTime). Does not print.
+vector<int> Graph::shortestPathAt(int src, int dest, int departureTime, SearchStats* stats) {
+    vector<int> path;
+    if (stats) *stats = SearchStats();
+    if (src < 0 || dest < 0 || src >= numVertices || dest >= numVertices) return path;
+    
+    auto start = chrono::high_resolution_clock::now();
+    vector<int> arrival(numVertices, INT_MAX);
+    vector<int> parent(numVertices, -1);
+    vector<bool> visited(numVertices, false);
+    IndexedMinHeap pq(numVertices);
+    int settled = 0;
+    
+    arrival[src] = departureTime;
+    pq.insert(src, departureTime);
+    
+    while (!pq.isEmpty()) {
+        int u = pq.extractMin();
+        visited[u] = true;
+        settled++;
+        if (u == dest) break;
+        
+        Edge* current = adjList[u].begin();
+        while (current != nullptr) {
+            int v = current->destination;
+            int travel = current->profile == -1 ? current->weight
+                                                : profiles.evaluate(current->profile, arrival[u]);
+            
+            if (!visited[v] && arrival[u] + travel < arrival[v]) {
+                arrival[v] = arrival[u] + travel;
+                parent[v] = u;
+                pq.insert(v, arrival[v]);
+            }
+            current = current->next;
+        }
+    }
+    
+    if (stats) {
+        stats->settledNodes = settled;
+        stats->distance = arrival[dest] == INT_MAX ? INT_MAX : arrival[dest] - departureTime;
+        stats->elapsedMs = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+    }
+    
+    if (arrival[dest] == INT_MAX) return path;
+    return CSRGraph::buildPath(parent, dest);
+}
+
+// A* Search - Time: O((V+E) log V) worst case, Space: O(V)
+// Vertices are expanded in order of dist + heuristic estimate, so a good
+// admissible heuristic settles far fewer vertices than Dijkstra. Settled
+// vertices are reopened if a shorter path appears, which keeps the result
+// optimal for admissible but inconsistent heuristics. Does not print.
+vector<int> Graph::aStar(int src, int dest, const Heuristic& heuristic, SearchStats* stats) {
+    vector<int> path;
+    if (stats) *stats = SearchStats();
+    if (src < 0 || dest < 0 || src >= numVertices || dest >= numVertices) return path;
+    
+    auto start = chrono::high_resolution_clock::now();
+    vector<int> dist(numVertices, INT_MAX);
+    vector<int> parent(numVertices, -1);
+    IndexedMinHeap pq(numVertices);
+    int settled = 0;
+    
+    dist[src] = 0;
+    pq.insert(src, heuristic.estimate(src, dest));
+    
+    while (!pq.isEmpty()) {
+        int u = pq.extractMin();
+        settled++;
+        if (u == dest) break;
+        
+        Edge* current = adjList[u].begin();
+        while (current != nullptr) {
+            int v = current->destination;
+            int newDist = dist[u] + current->weight;
+            
+            if (newDist < dist[v]) {
+                dist[v] = newDist;
+                parent[v] = u;
+                pq.insert(v, newDist + heuristic.estimate(v, dest));
+            }
+            current = current->next;
+        }
+    }
+    
+    if (stats) {
+        stats->settledNodes = settled;
+        stats->distance = dist[dest];
+        stats->elapsedMs = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+    }
+    
+    if (dist[dest] == INT_MAX) return path;
+    return CSRGraph::buildPath(parent, dest);
+}
+
+// Dijkstra's Algorithm - Time: O(V^2) with linear min-scan, Space: O(V)
+// Kept as the reference implementation for benchmarks and result checks.
+vector<int> Graph::shortestPathLinearScan(int src, int dest) {
     vector<int> path;
     if (src >= numVertices || dest >= numVertices) return path;
     
@@ -244,54 +804,413 @@ vector<int> Graph::shortestPath(int src, int dest) {
         }
     }
     
-    // Reconstruct path
     if (dist[dest] == INT_MAX) {
-        cout << "No path exists from station " << src << " to " << dest << endl;
+        LOG_INFO("No path exists from station " << src << " to " << dest);
         return path;
     }
     
-    // Reconstruct path manually (no std::reverse)
-    int current = dest;
-    while (current != -1) {
-        path.push_back(current);
-        current = parent[current];
+    path = CSRGraph::buildPath(parent, dest);
+    LOG_INFO("Shortest distance from station " << src << " to " << dest << ": " << dist[dest]);
+    return path;
+}
+
+// Per-thread scratch space for distanceMatrix, reset through the touched list
+struct MatrixWorkspace {
+    vector<int> dist;         // INT_MAX when untouched
+    vector<int> touched;
+    vector<int> targetStamp;  // == row + 1 for targets of the current row not yet settled
+    IndexedMinHeap queue;
+    MatrixWorkspace(int n) : dist(n, INT_MAX), targetStamp(n, 0), queue(n) {}
+};
+
+// Distance Matrix - Time: O(|sources| (V+E) log V / threads), Space: O(threads V + |sources||targets|)
+// Each source runs a Dijkstra over a CSR snapshot that stops once every
+// target is settled, then writes its own row of the preallocated matrix.
+vector<int> Graph::distanceMatrix(const vector<int>& sources, const vector<int>& targets, int threads) const {
+    int rows = sources.size();
+    int cols = targets.size();
+    vector<int> matrix((size_t)rows * cols, INT_MAX);
+    if (rows == 0 || cols == 0) return matrix;
+    
+    CSRGraph csr = freeze();
+    ThreadPool pool(threads < rows ? threads : rows);
+    vector<MatrixWorkspace*> workspaces(pool.getNumThreads(), nullptr);
+    
+    pool.parallelFor(rows, [&](int row, int worker) {
+        int src = sources[row];
+        if (src < 0 || src >= numVertices) return;
+        if (workspaces[worker] == nullptr) workspaces[worker] = new MatrixWorkspace(numVertices);
+        MatrixWorkspace& ws = *workspaces[worker];
+        
+        // Mark the distinct valid targets of this row
+        int remaining = 0;
+        for (int j = 0; j < cols; j++) {
+            int t = targets[j];
+            if (t >= 0 && t < numVertices && ws.targetStamp[t] != row + 1) {
+                ws.targetStamp[t] = row + 1;
+                remaining++;
+            }
+        }
+        
+        ws.dist[src] = 0;
+        ws.touched.push_back(src);
+        ws.queue.insert(src, 0);
+        while (!ws.queue.isEmpty() && remaining > 0) {
+            int u = ws.queue.extractMin();
+            if (ws.targetStamp[u] == row + 1) {
+                ws.targetStamp[u] = 0;
+                remaining--;
+            }
+            for (int e = csr.edgeBegin(u); e < csr.edgeEnd(u); e++) {
+                int v = csr.edgeTarget(e);
+                int newDist = ws.dist[u] + csr.edgeWeight(e);
+                if (newDist < ws.dist[v]) {
+                    if (ws.dist[v] == INT_MAX) ws.touched.push_back(v);
+                    ws.dist[v] = newDist;
+                    ws.queue.insert(v, newDist);
+                }
+            }
+        }
+        
+        int* out = &matrix[(size_t)row * cols];
+        for (int j = 0; j < cols; j++) {
+            int t = targets[j];
+            if (t >= 0 && t < numVertices) out[j] = ws.dist[t];
+        }
+        
+        // Reset only what this row touched (unreached targets keep a stale stamp,
+        // which is harmless because stamps are unique per row)
+        for (size_t i = 0; i < ws.touched.size(); i++) {
+            ws.dist[ws.touched[i]] = INT_MAX;
+        }
+        ws.touched.clear();
+        ws.queue.clear();
+    });
+    
+    for (size_t i = 0; i < workspaces.size(); i++) {
+        delete workspaces[i];
     }
-    // Manual reverse
-    int n = path.size();
-    for (int i = 0; i < n / 2; i++) {
-        int temp = path[i];
-        path[i] = path[n - 1 - i];
-        path[n - 1 - i] = temp;
+    return matrix;
+}
+
+// Per-thread state for betweennessCentrality
+struct BrandesWorkspace {
+    vector<int> dist;        // INT_MAX when untouched
+    vector<double> sigma;    // Number of shortest paths from the source
+    vector<double> delta;    // Dependency of the source on each station
+    vector<int> settled;     // Stations in settling order (non-decreasing distance)
+    vector<double> score;    // This thread's share of the result
+    IndexedMinHeap queue;
+    BrandesWorkspace(int n) : dist(n, INT_MAX), sigma(n, 0.0), delta(n, 0.0), score(n, 0.0), queue(n) {}
+};
+
+// Brandes' Algorithm - Time: O(S (V+E) log V / threads) for S sources, Space: O(threads V)
+// Each source runs a Dijkstra that counts shortest paths (sigma), then walks the
+// settled stations backwards accumulating dependencies: a station v gains
+// sigma[v] / sigma[w] * (1 + delta[w]) from every successor w on a shortest path.
+// Scores go to per-thread accumulators that are summed once all sources are done.
+vector<double> Graph::betweennessCentrality(int samples, int threads, unsigned int seed) const {
+    vector<double> centrality(numVertices, 0.0);
+    if (numVertices == 0) return centrality;
+    
+    vector<int> sources(numVertices);
+    for (int i = 0; i < numVertices; i++) sources[i] = i;
+    int count = numVertices;
+    if (samples > 0 && samples < numVertices) {
+        // Partial Fisher-Yates shuffle: the first 'samples' entries are a uniform pick
+        for (int i = 0; i < samples; i++) {
+            seed = seed * 1103515245 + 12345;
+            int j = i + (int)((seed >> 8) % (unsigned int)(numVertices - i));
+            int temp = sources[i];
+            sources[i] = sources[j];
+            sources[j] = temp;
+        }
+        count = samples;
     }
     
-    cout << "Shortest distance from station " << src << " to " << dest << ": " << dist[dest] << endl;
-    return path;
+    CSRGraph csr = freeze();
+    ThreadPool pool(threads < count ? threads : count);
+    vector<BrandesWorkspace*> workspaces(pool.getNumThreads(), nullptr);
+    
+    pool.parallelFor(count, [&](int task, int worker) {
+        if (workspaces[worker] == nullptr) workspaces[worker] = new BrandesWorkspace(numVertices);
+        BrandesWorkspace& ws = *workspaces[worker];
+        int src = sources[task];
+        
+        ws.dist[src] = 0;
+        ws.sigma[src] = 1.0;
+        ws.queue.insert(src, 0);
+        while (!ws.queue.isEmpty()) {
+            int u = ws.queue.extractMin();
+            ws.settled.push_back(u);
+            for (int e = csr.edgeBegin(u); e < csr.edgeEnd(u); e++) {
+                int v = csr.edgeTarget(e);
+                int newDist = ws.dist[u] + csr.edgeWeight(e);
+                if (newDist < ws.dist[v]) {
+                    ws.dist[v] = newDist;
+                    ws.sigma[v] = ws.sigma[u];
+                    ws.queue.insert(v, newDist);
+                } else if (newDist == ws.dist[v]) {
+                    ws.sigma[v] += ws.sigma[u];
+                }
+            }
+        }
+        
+        // Dependencies in reverse settling order; successors on shortest paths come later
+        for (int i = ws.settled.size() - 1; i >= 0; i--) {
+            int v = ws.settled[i];
+            for (int e = csr.edgeBegin(v); e < csr.edgeEnd(v); e++) {
+                int w = csr.edgeTarget(e);
+                if (ws.dist[w] == ws.dist[v] + csr.edgeWeight(e)) {
+                    ws.delta[v] += ws.sigma[v] / ws.sigma[w] * (1.0 + ws.delta[w]);
+                }
+            }
+            if (v != src) ws.score[v] += ws.delta[v];
+        }
+        
+        for (size_t i = 0; i < ws.settled.size(); i++) {
+            int v = ws.settled[i];
+            ws.dist[v] = INT_MAX;
+            ws.sigma[v] = 0.0;
+            ws.delta[v] = 0.0;
+        }
+        ws.settled.clear();
+    });
+    
+    double scale = (double)numVertices / count;
+    for (size_t w = 0; w < workspaces.size(); w++) {
+        if (workspaces[w] == nullptr) continue;
+        for (int v = 0; v < numVertices; v++) {
+            centrality[v] += workspaces[w]->score[v] * scale;
+        }
+        delete workspaces[w];
+    }
+    return centrality;
 }
 
-// Union-Find helper functions for Kruskal's algorithm
-int Graph::findParent(vector<int>& parent, int i) {
-    if (parent[i] == i) return i;
-    return parent[i] = findParent(parent, parent[i]);
-}
+// Spur searches for kShortestPaths over one CSR snapshot
+// Routes and stations are masked through bitsets, so the graph is never
+// copied or edited. Every search is A* guided by the exact distances to dest
+// on the unmasked graph (the reverse shortest path tree), which masking can
+// only increase, so the bound stays consistent. When the tree path from the
+// spur vertex avoids every masked route and station it is already optimal
+// and no search is run at all.
+struct SpurSearch {
+    const CSRGraph& graph;
+    const vector<int>& toDest;    // d(v, dest) on the unmasked graph, INT_MAX if dest is unreachable
+    const vector<int>& treeEdge;  // First edge of a shortest v -> dest path, -1 at dest
+    int dest;
+    vector<unsigned long long> bannedEdges;
+    vector<unsigned long long> bannedNodes;
+    vector<int> dist, parent, parentEdge, touched;
+    IndexedMinHeap queue;
+    
+    SpurSearch(const CSRGraph& g, const vector<int>& distances, const vector<int>& tree, int target)
+        : graph(g), toDest(distances), treeEdge(tree), dest(target),
+          bannedEdges((g.getNumEdges() + 63) / 64, 0), bannedNodes((g.getNumVertices() + 63) / 64, 0),
+          dist(g.getNumVertices(), INT_MAX), parent(g.getNumVertices(), -1),
+          parentEdge(g.getNumVertices(), -1), queue(g.getNumVertices()) {}
+    
+    static void setBit(vector<unsigned long long>& bits, int i, bool on) {
+        if (on) bits[i >> 6] |= 1ULL << (i & 63);
+        else bits[i >> 6] &= ~(1ULL << (i & 63));
+    }
+    static bool testBit(const vector<unsigned long long>& bits, int i) {
+        return (bits[i >> 6] >> (i & 63)) & 1ULL;
+    }
+    
+    // Cheapest spur -> dest path avoiding masked routes/stations; its edges are
+    // appended to edges. Returns the cost, INT_MAX if there is none.
+    int run(int spur, vector<int>& edges) {
+        // Fast path: the unmasked shortest path tree
+        int v = spur;
+        bool treeUsable = toDest[spur] != INT_MAX;
+        while (treeUsable && v != dest) {
+            int e = treeEdge[v];
+            if (testBit(bannedEdges, e) || testBit(bannedNodes, graph.edgeTarget(e))) treeUsable = false;
+            v = graph.edgeTarget(e);
+        }
+        if (treeUsable) {
+            for (v = spur; v != dest; v = graph.edgeTarget(treeEdge[v])) edges.push_back(treeEdge[v]);
+            return toDest[spur];
+        }
+        
+        // A* on the masked graph
+        dist[spur] = 0;
+        touched.push_back(spur);
+        queue.insert(spur, toDest[spur]);
+        while (!queue.isEmpty()) {
+            int u = queue.extractMin();
+            if (u == dest) break;
+            for (int e = graph.edgeBegin(u); e < graph.edgeEnd(u); e++) {
+                int w = graph.edgeTarget(e);
+                if (toDest[w] == INT_MAX || testBit(bannedEdges, e) || testBit(bannedNodes, w)) continue;
+                int newDist = dist[u] + graph.edgeWeight(e);
+                if (newDist < dist[w]) {
+                    if (dist[w] == INT_MAX) touched.push_back(w);
+                    dist[w] = newDist;
+                    parent[w] = u;
+                    parentEdge[w] = e;
+                    queue.insert(w, newDist + toDest[w]);
+                }
+            }
+        }
+        
+        int cost = dist[dest];
+        if (cost != INT_MAX) {
+            // Walk parent edges back from dest, then append them in forward order
+            vector<int> reversed;
+            for (int at = dest; at != spur; at = parent[at]) {
+                reversed.push_back(parentEdge[at]);
+            }
+            for (int i = (int)reversed.size() - 1; i >= 0; i--) edges.push_back(reversed[i]);
+        }
+        
+        for (size_t i = 0; i < touched.size(); i++) {
+            dist[touched[i]] = INT_MAX;
+        }
+        touched.clear();
+        queue.clear();
+        return cost;
+    }
+};
 
-void Graph::unionSets(vector<int>& parent, vector<int>& rank, int x, int y) {
-    int xRoot = findParent(parent, x);
-    int yRoot = findParent(parent, y);
+// K Shortest Loopless Paths (Yen, with Lawler's rule)
+// Time: O(k L (spur search)), Space: O(V + E/64 + kL) where L = path length
+// Each new path is the cheapest deviation of an accepted one: for every spur
+// vertex of the newest path (from the point where it left its parent path
+// onwards, which is all Lawler's rule requires), the next route of every
+// accepted path sharing the same root is masked, the root's stations are
+// masked, and a spur search completes the path.
+vector<vector<int>> Graph::kShortestPaths(int src, int dest, int k, vector<int>* costs) const {
+    vector<vector<int>> result;
+    if (costs) costs->clear();
+    if (k <= 0 || src < 0 || dest < 0 || src >= numVertices || dest >= numVertices) return result;
+    
+    CSRGraph forward = freeze();
+    CSRGraph backward = freezeReverse();
+    
+    // Reverse shortest path tree: exact distance to dest and next station towards it
+    vector<int> toDest(numVertices, INT_MAX);
+    vector<int> successor(numVertices, -1);
+    IndexedMinHeap pq(numVertices);
+    toDest[dest] = 0;
+    pq.insert(dest, 0);
+    while (!pq.isEmpty()) {
+        int u = pq.extractMin();
+        for (int e = backward.edgeBegin(u); e < backward.edgeEnd(u); e++) {
+            int v = backward.edgeTarget(e);
+            int newDist = toDest[u] + backward.edgeWeight(e);
+            if (newDist < toDest[v]) {
+                toDest[v] = newDist;
+                successor[v] = u;
+                pq.insert(v, newDist);
+            }
+        }
+    }
+    if (toDest[src] == INT_MAX) return result;
+    
+    vector<int> treeEdge(numVertices, -1);
+    for (int v = 0; v < numVertices; v++) {
+        if (successor[v] == -1) continue;
+        for (int e = forward.edgeBegin(v); e < forward.edgeEnd(v); e++) {
+            if (forward.edgeTarget(e) == successor[v]) {
+                treeEdge[v] = e;
+                break;
+            }
+        }
+    }
+    
+    // Paths are kept as edge lists; deviation = index of the first edge off the parent path
+    struct KPath {
+        vector<int> edges;
+        int cost;
+        int deviation;
+    };
+    SpurSearch search(forward, toDest, treeEdge, dest);
+    vector<KPath> accepted;
+    vector<KPath> candidates;
+    
+    KPath first;
+    first.cost = search.run(src, first.edges);
+    first.deviation = 0;
+    accepted.push_back(first);
+    
+    while ((int)accepted.size() < k) {
+        KPath last = accepted.back();
+        int length = last.edges.size();
+        vector<int> nodes(1, src);
+        for (int i = 0; i < length; i++) nodes.push_back(forward.edgeTarget(last.edges[i]));
+        
+        int rootCost = 0;
+        for (int i = 0; i < last.deviation; i++) {
+            rootCost += forward.edgeWeight(last.edges[i]);
+            SpurSearch::setBit(search.bannedNodes, nodes[i], true);
+        }
+        
+        for (int i = last.deviation; i < length; i++) {
+            // Mask the next route of every accepted path that shares this root
+            vector<int> masked;
+            for (size_t p = 0; p < accepted.size(); p++) {
+                const vector<int>& edges = accepted[p].edges;
+                if ((int)edges.size() <= i) continue;
+                bool sameRoot = true;
+                for (int j = 0; j < i && sameRoot; j++) {
+                    if (edges[j] != last.edges[j]) sameRoot = false;
+                }
+                if (sameRoot) {
+                    SpurSearch::setBit(search.bannedEdges, edges[i], true);
+                    masked.push_back(edges[i]);
+                }
+            }
+            
+            KPath candidate;
+            candidate.edges.assign(last.edges.begin(), last.edges.begin() + i);
+            int spurCost = search.run(nodes[i], candidate.edges);
+            if (spurCost != INT_MAX) {
+                candidate.cost = rootCost + spurCost;
+                candidate.deviation = i;
+                bool duplicate = false;
+                for (size_t c = 0; c < candidates.size() && !duplicate; c++) {
+                    if (candidates[c].edges == candidate.edges) duplicate = true;
+                }
+                if (!duplicate) candidates.push_back(candidate);
+            }
+            
+            for (size_t m = 0; m < masked.size(); m++) {
+                SpurSearch::setBit(search.bannedEdges, masked[m], false);
+            }
+            SpurSearch::setBit(search.bannedNodes, nodes[i], true);
+            rootCost += forward.edgeWeight(last.edges[i]);
+        }
+        for (int i = 0; i < length; i++) {
+            SpurSearch::setBit(search.bannedNodes, nodes[i], false);
+        }
+        
+        if (candidates.empty()) break;
+        
+        // Cheapest candidate (earliest found on ties) becomes the next path
+        int best = 0;
+        for (size_t c = 1; c < candidates.size(); c++) {
+            if (candidates[c].cost < candidates[best].cost) best = c;
+        }
+        accepted.push_back(candidates[best]);
+        candidates.erase(candidates.begin() + best);
+    }
     
-    if (rank[xRoot] < rank[yRoot]) {
-        parent[xRoot] = yRoot;
-    } else if (rank[xRoot] > rank[yRoot]) {
-        parent[yRoot] = xRoot;
-    } else {
-        parent[yRoot] = xRoot;
-        rank[xRoot]++;
+    for (size_t p = 0; p < accepted.size(); p++) {
+        vector<int> path(1, src);
+        for (size_t i = 0; i < accepted[p].edges.size(); i++) {
+            path.push_back(forward.edgeTarget(accepted[p].edges[i]));
+        }
+        result.push_back(path);
+        if (costs) costs->push_back(accepted[p].cost);
     }
+    return result;
 }
 
-// Kruskal's Algorithm for MST - Time: O(E log E), Space: O(V)
+// Kruskal's Algorithm for MST - Time: O(E α(V)) after the O(E) radix sort, Space: O(V+E)
 vector<pair<pair<int, int>, int>> Graph::minimumSpanningTree() {
-    vector<pair<pair<int, int>, int>> mst;
-    
     // Collect all edges
     vector<pair<int, pair<int, int>>> edges;
     for (int u = 0; u < numVertices; u++) {
@@ -304,61 +1223,181 @@ vector<pair<pair<int, int>, int>> Graph::minimumSpanningTree() {
         }
     }
     
-    // Sort edges by weight using manual sorting (no external libraries)
-    sortEdges(edges);
+    return CSRGraph::kruskal(edges, numVertices);
+}
+
+// Prim's Algorithm for MST - Time: O((V+E) log V) with indexed min-heap, Space: O(V)
+// A route u -> v (u < v) is reachable from both ends: forwards from u through
+// adjList and backwards from v through reverseAdjList. Each unreached station
+// starts a new tree, so disconnected networks yield a spanning forest.
+vector<pair<pair<int, int>, int>> Graph::minimumSpanningTreePrim() const {
+    vector<pair<pair<int, int>, int>> mst;
+    vector<int> key(numVertices, INT_MAX);
+    vector<int> via(numVertices, -1);
+    vector<bool> inTree(numVertices, false);
+    IndexedMinHeap pq(numVertices);
+    
+    for (int root = 0; root < numVertices; root++) {
+        if (inTree[root]) continue;
+        key[root] = INT_MIN;
+        pq.insert(root, INT_MIN);
+        
+        while (!pq.isEmpty()) {
+            int u = pq.extractMin();
+            inTree[u] = true;
+            if (via[u] != -1) {
+                int a = via[u] < u ? via[u] : u;
+                int b = via[u] < u ? u : via[u];
+                mst.push_back({{a, b}, key[u]});
+            }
+            
+            Edge* current = adjList[u].begin();
+            while (current != nullptr) {
+                int v = current->destination;
+                if (u < v && !inTree[v] && current->weight < key[v]) {
+                    key[v] = current->weight;
+                    via[v] = u;
+                    pq.insert(v, key[v]);
+                }
+                current = current->next;
+            }
+            Edge* incoming = reverseAdjList[u].begin();
+            while (incoming != nullptr) {
+                int v = incoming->destination;
+                if (v < u && !inTree[v] && incoming->weight < key[v]) {
+                    key[v] = incoming->weight;
+                    via[v] = u;
+                    pq.insert(v, key[v]);
+                }
+                incoming = incoming->next;
+            }
+        }
+    }
+    
+    return mst;
+}
+
+// Boruvka's Algorithm for MST - Time: O(E log V) work over O(log V) rounds, Space: O(V+E)
+// Every round, the thread pool scans the remaining routes and each component
+// keeps its cheapest outgoing one through an atomic minimum on a packed
+// (weight, route index) key; the index breaks ties, so the chosen routes never
+// form a cycle. The chosen routes are then merged with union-find and routes
+// now inside a component are dropped, so later rounds scan fewer of them.
+vector<pair<pair<int, int>, int>> Graph::minimumSpanningTreeBoruvka(int threads) const {
+    const int CHUNK = 16384;
+    const unsigned long long NONE = ~0ULL;
+    vector<pair<pair<int, int>, int>> mst;
+    
+    vector<int> from, to, weight;
+    for (int u = 0; u < numVertices; u++) {
+        Edge* current = adjList[u].begin();
+        while (current != nullptr) {
+            if (u < current->destination) {
+                from.push_back(u);
+                to.push_back(current->destination);
+                weight.push_back(current->weight);
+            }
+            current = current->next;
+        }
+    }
     
-    // Union-Find data structure
-    vector<int> parent(numVertices);
-    vector<int> rank(numVertices, 0);
+    vector<int> parent(numVertices), rank(numVertices, 0), component(numVertices);
     for (int i = 0; i < numVertices; i++) {
         parent[i] = i;
+        component[i] = i;
     }
+    vector<atomic<unsigned long long>> cheapest(numVertices);
+    for (int i = 0; i < numVertices; i++) cheapest[i].store(NONE, memory_order_relaxed);
+    ThreadPool pool(threads);
     
-    // Kruskal's algorithm
-    for (const auto& edge : edges) {
-        int u = edge.second.first;
-        int v = edge.second.second;
+    while (!from.empty()) {
+        int m = from.size();
+        pool.parallelFor((m + CHUNK - 1) / CHUNK, [&](int chunk, int) {
+            int last = (chunk + 1) * CHUNK < m ? (chunk + 1) * CHUNK : m;
+            for (int e = chunk * CHUNK; e < last; e++) {
+                unsigned long long packed =
+                    ((unsigned long long)((unsigned int)weight[e] ^ 0x80000000u) << 32) | (unsigned int)e;
+                int ends[2] = {component[from[e]], component[to[e]]};
+                for (int k = 0; k < 2; k++) {
+                    unsigned long long seen = cheapest[ends[k]].load(memory_order_relaxed);
+                    while (packed < seen &&
+                           !cheapest[ends[k]].compare_exchange_weak(seen, packed, memory_order_relaxed)) {
+                    }
+                }
+            }
+        });
         
-        int uRoot = findParent(parent, u);
-        int vRoot = findParent(parent, v);
+        // Merge every component with its cheapest neighbour
+        for (int c = 0; c < numVertices; c++) {
+            unsigned long long packed = cheapest[c].load(memory_order_relaxed);
+            if (packed == NONE) continue;
+            cheapest[c].store(NONE, memory_order_relaxed);
+            int e = (int)(packed & 0xFFFFFFFFULL);
+            int uRoot = CSRGraph::findParent(parent, from[e]);
+            int vRoot = CSRGraph::findParent(parent, to[e]);
+            if (uRoot != vRoot) {
+                mst.push_back({{from[e], to[e]}, weight[e]});
+                CSRGraph::unionSets(parent, rank, uRoot, vRoot);
+            }
+        }
+        for (int v = 0; v < numVertices; v++) {
+            component[v] = CSRGraph::findParent(parent, v);
+        }
         
-        if (uRoot != vRoot) {
-            mst.push_back({{u, v}, edge.first});
-            unionSets(parent, rank, uRoot, vRoot);
+        // Keep only routes that still join two components
+        int kept = 0;
+        for (int e = 0; e < m; e++) {
+            if (component[from[e]] != component[to[e]]) {
+                from[kept] = from[e];
+                to[kept] = to[e];
+                weight[kept] = weight[e];
+                kept++;
+            }
         }
+        from.resize(kept);
+        to.resize(kept);
+        weight.resize(kept);
     }
     
     return mst;
 }
 
-// Cycle Detection using DFS - Time: O(V+E), Space: O(V)
-bool Graph::hasCycleUtil(int v, vector<bool>& visited, vector<bool>& recStack) {
-    visited[v] = true;
-    recStack[v] = true;
+// Cycle Detection using iterative DFS - Time: O(V+E), Space: O(V)
+// A station on the current stack is marked stamp + 1; reaching one again closes a cycle
+bool Graph::hasCycleUtil(int v) {
+    visitMark[v] = visitStamp + 1;
+    stackVertex.push_back(v);
+    stackEdge.push_back(adjList[v].begin());
     
-    Edge* current = adjList[v].begin();
-    while (current != nullptr) {
-        if (!visited[current->destination]) {
-            if (hasCycleUtil(current->destination, visited, recStack)) {
-                return true;
-            }
-        } else if (recStack[current->destination]) {
-            return true;
+    while (!stackVertex.empty()) {
+        Edge*& current = stackEdge.back();
+        if (current == nullptr) {
+            visitMark[stackVertex.back()] = visitStamp;
+            stackVertex.pop_back();
+            stackEdge.pop_back();
+            continue;
         }
+        
+        int w = current->destination;
         current = current->next;
+        if (visitMark[w] < visitStamp) {
+            visitMark[w] = visitStamp + 1;
+            stackVertex.push_back(w);
+            stackEdge.push_back(adjList[w].begin());
+        } else if (visitMark[w] == visitStamp + 1) {
+            return true;
+        }
     }
     
-    recStack[v] = false;
     return false;
 }
 
 bool Graph::detectCycle() {
-    vector<bool> visited(numVertices, false);
-    vector<bool> recStack(numVertices, false);
+    beginTraversal();
     
     for (int i = 0; i < numVertices; i++) {
-        if (!visited[i]) {
-            if (hasCycleUtil(i, visited, recStack)) {
+        if (visitMark[i] < visitStamp) {
+            if (hasCycleUtil(i)) {
                 return true;
             }
         }
@@ -367,10 +1406,337 @@ bool Graph::detectCycle() {
     return false;
 }
 
-bool Graph::stationExists(int id) const {
-    for (const auto& station : stations) {
-        if (station.id == id) return true;
+// Tarjan's SCC Algorithm with an explicit call stack - Time: O(V+E), Space: O(V)
+// A station is on Tarjan's stack while it has an index but no component yet
+int Graph::stronglyConnectedComponents(vector<int>& component) const {
+    component.assign(numVertices, -1);
+    vector<int> index(numVertices, -1);
+    vector<int> low(numVertices, 0);
+    vector<int> sccStack;
+    vector<int> callVertex;
+    vector<Edge*> callEdge;
+    int counter = 0;
+    int count = 0;
+    
+    for (int root = 0; root < numVertices; root++) {
+        if (index[root] != -1) continue;
+        
+        index[root] = low[root] = counter++;
+        sccStack.push_back(root);
+        callVertex.push_back(root);
+        callEdge.push_back(adjList[root].begin());
+        
+        while (!callVertex.empty()) {
+            int v = callVertex.back();
+            Edge*& current = callEdge.back();
+            if (current != nullptr) {
+                int w = current->destination;
+                current = current->next;
+                if (index[w] == -1) {
+                    index[w] = low[w] = counter++;
+                    sccStack.push_back(w);
+                    callVertex.push_back(w);
+                    callEdge.push_back(adjList[w].begin());
+                } else if (component[w] == -1 && index[w] < low[v]) {
+                    low[v] = index[w];
+                }
+                continue;
+            }
+            
+            // All routes of v explored: return to the caller
+            callVertex.pop_back();
+            callEdge.pop_back();
+            if (!callVertex.empty() && low[v] < low[callVertex.back()]) {
+                low[callVertex.back()] = low[v];
+            }
+            if (low[v] == index[v]) {
+                int w;
+                do {
+                    w = sccStack.back();
+                    sccStack.pop_back();
+                    component[w] = count;
+                } while (w != v);
+                count++;
+            }
+        }
     }
-    return false;
+    
+    return count;
+}
+
+// Condensation - Time: O(V+E), Space: O(V + component routes)
+CSRGraph Graph::condensation(const vector<int>& component, int numComponents) const {
+    CSRGraph dag;
+    dag.numVertices = numComponents;
+    dag.offsets.assign(numComponents + 1, 0);
+    
+    // Group stations by component (counting sort)
+    vector<int> memberOffsets(numComponents + 1, 0);
+    for (int v = 0; v < numVertices; v++) {
+        memberOffsets[component[v] + 1]++;
+    }
+    for (int c = 0; c < numComponents; c++) {
+        memberOffsets[c + 1] += memberOffsets[c];
+    }
+    vector<int> members(numVertices);
+    vector<int> fill(memberOffsets.begin(), memberOffsets.end() - 1);
+    for (int v = 0; v < numVertices; v++) {
+        members[fill[component[v]]++] = v;
+    }
+    
+    // slot[d] is the position of the route to d in the current row, valid while seenBy[d] == c
+    vector<int> seenBy(numComponents, -1);
+    vector<int> slot(numComponents, 0);
+    for (int c = 0; c < numComponents; c++) {
+        for (int i = memberOffsets[c]; i < memberOffsets[c + 1]; i++) {
+            Edge* current = adjList[members[i]].begin();
+            while (current != nullptr) {
+                int d = component[current->destination];
+                if (d != c) {
+                    if (seenBy[d] != c) {
+                        seenBy[d] = c;
+                        slot[d] = dag.targets.size();
+                        dag.targets.push_back(d);
+                        dag.weights.push_back(current->weight);
+                    } else if (current->weight < dag.weights[slot[d]]) {
+                        dag.weights[slot[d]] = current->weight;
+                    }
+                }
+                current = current->next;
+            }
+        }
+        dag.offsets[c + 1] = dag.targets.size();
+    }
+    
+    return dag;
+}
+
+// ==================== DYNAMIC HUB TREES ====================
+
+// Full Dijkstra from the hub - Time: O((V+E) log V), Space: O(V)
+void Graph::buildHubTree(HubTree& tree) {
+    tree.dist.assign(numVertices, INT_MAX);
+    tree.parent.assign(numVertices, -1);
+    IndexedMinHeap pq(numVertices);
+    tree.dist[tree.hub] = 0;
+    pq.insert(tree.hub, 0);
+    
+    while (!pq.isEmpty()) {
+        int u = pq.extractMin();
+        Edge* current = adjList[u].begin();
+        while (current != nullptr) {
+            int v = current->destination;
+            if (tree.dist[u] + current->weight < tree.dist[v]) {
+                tree.dist[v] = tree.dist[u] + current->weight;
+                tree.parent[v] = u;
+                pq.insert(v, tree.dist[v]);
+            }
+            current = current->next;
+        }
+    }
+}
+
+bool Graph::addHub(int station) {
+    if (!stationExists(station)) {
+        LOG_ERROR("Station with ID " << station << " does not exist!");
+        return false;
+    }
+    for (size_t h = 0; h < hubTrees.size(); h++) {
+        if (hubTrees[h].hub == station) return true;
+    }
+    
+    HubTree tree;
+    tree.hub = station;
+    buildHubTree(tree);
+    hubTrees.push_back(tree);
+    return true;
+}
+
+void Graph::removeHub(int station) {
+    for (size_t h = 0; h < hubTrees.size(); h++) {
+        if (hubTrees[h].hub == station) {
+            hubTrees.erase(hubTrees.begin() + h);
+            return;
+        }
+    }
+}
+
+// Hub Distance - Time: O(hubs), Space: O(1)
+int Graph::hubDistance(int hub, int dest) const {
+    for (size_t h = 0; h < hubTrees.size(); h++) {
+        if (hubTrees[h].hub == hub) {
+            if (dest < 0 || dest >= numVertices) return INT_MAX;
+            return hubTrees[h].dist[dest];
+        }
+    }
+    return -1;
+}
+
+// Hub Path - follows tree parents back from dest. Time: O(hubs + path length)
+vector<int> Graph::hubPath(int hub, int dest) const {
+    vector<int> path;
+    if (hubDistance(hub, dest) == -1 || hubDistance(hub, dest) == INT_MAX) return path;
+    for (size_t h = 0; h < hubTrees.size(); h++) {
+        if (hubTrees[h].hub == hub) {
+            path = CSRGraph::buildPath(hubTrees[h].parent, dest);
+            break;
+        }
+    }
+    return path;
+}
+
+// Sizes the shared repair workspace after the station range changed
+void Graph::prepareRepair() {
+    if ((int)repairMark.size() != numVertices) {
+        repairMark.assign(numVertices, 0);
+        repairStamp = 0;
+        repairQueue.reset(numVertices);
+    }
+}
+
+// Route src -> dest changed from oldWeight to newWeight (-1 = absent)
+void Graph::onRouteChanged(int src, int dest, int oldWeight, int newWeight) {
+    lastRepairCount = 0;
+    if (hubTrees.empty() || oldWeight == newWeight) return;
+    prepareRepair();
+    
+    for (size_t h = 0; h < hubTrees.size(); h++) {
+        HubTree& tree = hubTrees[h];
+        if (newWeight != -1 && (oldWeight == -1 || newWeight < oldWeight)) {
+            repairDecrease(tree, src, dest, newWeight);
+        } else if (tree.parent[dest] == src) {
+            // Only a tree route can lengthen shortest paths
+            repairIncrease(tree, src, dest);
+        }
+    }
+}
+
+// Decrease - Dijkstra seeded at dest that only visits stations whose
+// distance improves. Time: O(affected (degree) log V)
+void Graph::repairDecrease(HubTree& tree, int src, int dest, int weight) {
+    if (tree.dist[src] == INT_MAX || tree.dist[src] + weight >= tree.dist[dest]) return;
+    
+    tree.dist[dest] = tree.dist[src] + weight;
+    tree.parent[dest] = src;
+    repairQueue.insert(dest, tree.dist[dest]);
+    
+    while (!repairQueue.isEmpty()) {
+        int u = repairQueue.extractMin();
+        lastRepairCount++;
+        Edge* current = adjList[u].begin();
+        while (current != nullptr) {
+            int v = current->destination;
+            if (tree.dist[u] + current->weight < tree.dist[v]) {
+                tree.dist[v] = tree.dist[u] + current->weight;
+                tree.parent[v] = u;
+                repairQueue.insert(v, tree.dist[v]);
+            }
+            current = current->next;
+        }
+    }
+}
+
+// Increase (or removal) of tree route src -> dest
+// Stations outside dest's subtree keep their distances, so only the subtree
+// is relabelled: each member starts from its best incoming route from
+// outside the subtree, then a Dijkstra restricted to the subtree settles it.
+// Time: O(subtree (degree) log V)
+void Graph::repairIncrease(HubTree& tree, int src, int dest) {
+    (void)src;
+    repairStamp++;
+    repairList.clear();
+    repairList.push_back(dest);
+    repairMark[dest] = repairStamp;
+    
+    // Collect the subtree hanging from dest through the tree's parent links
+    for (size_t i = 0; i < repairList.size(); i++) {
+        int u = repairList[i];
+        Edge* current = adjList[u].begin();
+        while (current != nullptr) {
+            int v = current->destination;
+            if (tree.parent[v] == u && repairMark[v] != repairStamp) {
+                repairMark[v] = repairStamp;
+                repairList.push_back(v);
+            }
+            current = current->next;
+        }
+    }
+    
+    for (size_t i = 0; i < repairList.size(); i++) {
+        tree.dist[repairList[i]] = INT_MAX;
+        tree.parent[repairList[i]] = -1;
+    }
+    
+    // Best entry into the subtree from the unaffected part of the tree
+    for (size_t i = 0; i < repairList.size(); i++) {
+        int v = repairList[i];
+        Edge* incoming = reverseAdjList[v].begin();
+        while (incoming != nullptr) {
+            int u = incoming->destination;
+            if (repairMark[u] != repairStamp && tree.dist[u] != INT_MAX &&
+                tree.dist[u] + incoming->weight < tree.dist[v]) {
+                tree.dist[v] = tree.dist[u] + incoming->weight;
+                tree.parent[v] = u;
+            }
+            incoming = incoming->next;
+        }
+        if (tree.dist[v] != INT_MAX) repairQueue.insert(v, tree.dist[v]);
+    }
+    
+    while (!repairQueue.isEmpty()) {
+        int u = repairQueue.extractMin();
+        Edge* current = adjList[u].begin();
+        while (current != nullptr) {
+            int v = current->destination;
+            if (repairMark[v] == repairStamp && tree.dist[u] + current->weight < tree.dist[v]) {
+                tree.dist[v] = tree.dist[u] + current->weight;
+                tree.parent[v] = u;
+                repairQueue.insert(v, tree.dist[v]);
+            }
+            current = current->next;
+        }
+    }
+    lastRepairCount += repairList.size();
+}
+
+// Packs a set of adjacency lists into contiguous CSR arrays
+// Time: O(V+E), Space: O(V+E)
+CSRGraph Graph::packLists(const vector<EdgeList>& lists) const {
+    CSRGraph csr;
+    csr.numVertices = numVertices;
+    csr.offsets.assign(numVertices + 1, 0);
+    
+    for (int u = 0; u < numVertices; u++) {
+        csr.offsets[u + 1] = csr.offsets[u] + lists[u].size();
+    }
+    
+    csr.targets.resize(csr.offsets[numVertices]);
+    csr.weights.resize(csr.offsets[numVertices]);
+    for (int u = 0; u < numVertices; u++) {
+        int e = csr.offsets[u];
+        Edge* current = lists[u].begin();
+        while (current != nullptr) {
+            csr.targets[e] = current->destination;
+            csr.weights[e] = current->weight;
+            e++;
+            current = current->next;
+        }
+    }
+    
+    return csr;
+}
+
+// Freeze - snapshot of the outgoing routes
+CSRGraph Graph::freeze() const {
+    return packLists(adjList);
+}
+
+// Freeze Reverse - snapshot of the incoming routes (every route flipped)
+CSRGraph Graph::freezeReverse() const {
+    return packLists(reverseAdjList);
+}
+
+bool Graph::stationExists(int id) const {
+    return findStationSlot(id) != -1;
 }
 
@@ -0,0 +1,297 @@
+#include "GraphFile.h"
+#include <fstream>
+#include <cstring>
+#ifdef _WIN32
+#include <cstdio>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const char GRAPH_MAGIC[4] = {'I', 'T', 'N', 'G'};
+static const int GRAPH_VERSION = 1;
+static const unsigned long long CHECKSUM_SEED = 1469598103934665603ULL;
+
+// The on-disk layout is the in-memory layout of these structs
+static_assert(sizeof(GraphFileHeader) == 64, "GraphFileHeader must stay 64 bytes");
+static_assert(sizeof(StationRecord) == 32, "StationRecord must stay 32 bytes");
+
+MappedGraph::MappedGraph()
+    : base(nullptr), length(0), handle(nullptr), header(nullptr), stationTable(nullptr),
+      stationSlots(nullptr), stringPool(nullptr), offsets(nullptr), targets(nullptr), weights(nullptr) {}
+
+MappedGraph::~MappedGraph() {
+    close();
+}
+
+// FNV-style hash over 8-byte words - Time: O(bytes), bytes must be a multiple of 8
+unsigned long long MappedGraph::checksumOf(const char* data, long long bytes, unsigned long long hash) {
+    for (long long i = 0; i < bytes; i += 8) {
+        unsigned long long word;
+        memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Appends one section, zero-padded to 8 bytes, and folds it into the checksum
+static void writeSection(ofstream& out, const void* data, long long bytes, unsigned long long& hash) {
+    static const char zeros[8] = {0};
+    long long padded = (bytes + 7) & ~7LL;
+    if (bytes > 0) out.write(static_cast<const char*>(data), bytes);
+    out.write(zeros, padded - bytes);
+    
+    // Hash whole words, then the last partial word together with its padding
+    long long whole = bytes & ~7LL;
+    unsigned long long state = hash;
+    for (long long i = 0; i < whole; i += 8) {
+        unsigned long long word;
+        memcpy(&word, static_cast<const char*>(data) + i, 8);
+        state = (state ^ word) * 1099511628211ULL;
+    }
+    if (padded > whole) {
+        unsigned long long word = 0;
+        memcpy(&word, static_cast<const char*>(data) + whole, bytes - whole);
+        state = (state ^ word) * 1099511628211ULL;
+    }
+    hash = state;
+}
+
+// Write - header placeholder, sections, then the final header with the checksum
+bool MappedGraph::write(const Graph& graph, const string& filename) {
+    CSRGraph csr = graph.freeze();
+    vector<Station> stations = graph.getAllStations();
+    int vertices = graph.getNumVertices();
+    long long edges = csr.getNumEdges();
+    
+    vector<StationRecord> records(stations.size());
+    vector<int> slots(vertices, -1);
+    string pool;
+    for (size_t i = 0; i < stations.size(); i++) {
+        StationRecord& record = records[i];
+        memset(&record, 0, sizeof(record));
+        record.id = stations[i].id;
+        record.nameOffset = pool.size();
+        record.nameLength = stations[i].name.size();
+        record.hasCoordinates = stations[i].hasCoordinates ? 1 : 0;
+        record.x = stations[i].x;
+        record.y = stations[i].y;
+        pool += stations[i].name;
+        if (record.id >= 0 && record.id < vertices) slots[record.id] = i;
+    }
+    
+    vector<int> offsets(vertices + 1, 0), targets(edges), weights(edges);
+    for (int v = 0; v < vertices; v++) {
+        offsets[v + 1] = csr.edgeEnd(v);
+        for (int e = csr.edgeBegin(v); e < csr.edgeEnd(v); e++) {
+            targets[e] = csr.edgeTarget(e);
+            weights[e] = csr.edgeWeight(e);
+        }
+    }
+    
+    ofstream out(filename.c_str(), ios::binary);
+    if (!out) return false;
+    
+    GraphFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GRAPH_MAGIC, 4);
+    header.version = GRAPH_VERSION;
+    header.numVertices = vertices;
+    header.numStations = records.size();
+    header.numEdges = edges;
+    header.stringPoolBytes = pool.size();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    
+    unsigned long long hash = CHECKSUM_SEED;
+    writeSection(out, records.empty() ? nullptr : &records[0], sizeof(StationRecord) * records.size(), hash);
+    writeSection(out, slots.empty() ? nullptr : &slots[0], sizeof(int) * (long long)vertices, hash);
+    writeSection(out, pool.data(), pool.size(), hash);
+    writeSection(out, &offsets[0], sizeof(int) * (long long)(vertices + 1), hash);
+    writeSection(out, targets.empty() ? nullptr : &targets[0], sizeof(int) * edges, hash);
+    writeSection(out, weights.empty() ? nullptr : &weights[0], sizeof(int) * edges, hash);
+    
+    header.fileBytes = out.tellp();
+    header.checksum = hash;
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return out.good();
+}
+
+// Attach - checks the header against the mapping size; O(1)
+bool MappedGraph::attach() {
+    if (length < (long long)sizeof(GraphFileHeader)) return false;
+    header = reinterpret_cast<const GraphFileHeader*>(base);
+    if (memcmp(header->magic, GRAPH_MAGIC, 4) != 0 || header->version != GRAPH_VERSION) return false;
+    
+    long long vertices = header->numVertices;
+    long long count = header->numStations;
+    if (vertices < 0 || count < 0 || count > vertices || header->numEdges < 0 ||
+        header->numEdges > INT_MAX || header->stringPoolBytes < 0 || header->stringPoolBytes > INT_MAX) return false;
+    
+    long long position = sizeof(GraphFileHeader);
+    long long stationBytes = align8(sizeof(StationRecord) * count);
+    long long slotBytes = align8(sizeof(int) * vertices);
+    long long poolBytes = align8(header->stringPoolBytes);
+    long long offsetBytes = align8(sizeof(int) * (vertices + 1));
+    long long edgeBytes = align8(sizeof(int) * header->numEdges);
+    if (header->fileBytes != length ||
+        position + stationBytes + slotBytes + poolBytes + offsetBytes + 2 * edgeBytes != length) return false;
+    
+    stationTable = reinterpret_cast<const StationRecord*>(base + position);
+    position += stationBytes;
+    stationSlots = reinterpret_cast<const int*>(base + position);
+    position += slotBytes;
+    stringPool = base + position;
+    position += poolBytes;
+    offsets = reinterpret_cast<const int*>(base + position);
+    position += offsetBytes;
+    targets = reinterpret_cast<const int*>(base + position);
+    position += edgeBytes;
+    weights = reinterpret_cast<const int*>(base + position);
+    return true;
+}
+
+bool MappedGraph::open(const string& filename) {
+    close();
+#ifdef _WIN32
+    FILE* file = fopen(filename.c_str(), "rb");
+    if (file == nullptr) return false;
+    fseek(file, 0, SEEK_END);
+    long long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* buffer = new char[size > 0 ? size : 1];
+    bool ok = size > 0 && fread(buffer, 1, size, file) == (size_t)size;
+    fclose(file);
+    if (!ok) {
+        delete[] buffer;
+        return false;
+    }
+    handle = buffer;
+    base = buffer;
+    length = size;
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    void* mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping stays valid
+    if (mapping == MAP_FAILED) return false;
+    base = static_cast<const char*>(mapping);
+    length = info.st_size;
+#endif
+    if (!attach() || !checkStructure()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedGraph::close() {
+    if (base != nullptr) {
+#ifdef _WIN32
+        delete[] static_cast<char*>(handle);
+#else
+        munmap(const_cast<char*>(base), length);
+#endif
+    }
+    base = nullptr;
+    handle = nullptr;
+    length = 0;
+    header = nullptr;
+    stationTable = nullptr;
+    stationSlots = nullptr;
+    stringPool = nullptr;
+    offsets = targets = weights = nullptr;
+}
+
+// Check Structure - every index the queries will follow - Time: O(V+E)
+bool MappedGraph::checkStructure() const {
+    int vertices = header->numVertices;
+    long long edges = header->numEdges;
+    if (offsets[0] != 0 || offsets[vertices] != edges) return false;
+    for (int v = 0; v < vertices; v++) {
+        if (offsets[v] > offsets[v + 1]) return false;
+        if (stationSlots[v] < -1 || stationSlots[v] >= header->numStations) return false;
+        if (stationSlots[v] >= 0 && stationTable[stationSlots[v]].id != v) return false;
+    }
+    for (long long e = 0; e < edges; e++) {
+        if (targets[e] < 0 || targets[e] >= vertices) return false;
+    }
+    for (int i = 0; i < header->numStations; i++) {
+        const StationRecord& record = stationTable[i];
+        if (record.id < 0 || record.id >= vertices || stationSlots[record.id] != i ||
+            record.nameOffset < 0 || record.nameLength < 0 ||
+            (long long)record.nameOffset + record.nameLength > header->stringPoolBytes) return false;
+    }
+    return true;
+}
+
+// Verify - checksum, then the structure again - Time: O(file size)
+bool MappedGraph::verify() const {
+    if (base == nullptr) return false;
+    long long payload = length - sizeof(GraphFileHeader);
+    if (checksumOf(base + sizeof(GraphFileHeader), payload, CHECKSUM_SEED) != header->checksum) return false;
+    return checkStructure();
+}
+
+bool MappedGraph::stationExists(int id) const {
+    return base != nullptr && id >= 0 && id < header->numVertices && stationSlots[id] != -1;
+}
+
+string MappedGraph::stationName(int id) const {
+    if (!stationExists(id)) return "";
+    const StationRecord& record = stationTable[stationSlots[id]];
+    return string(stringPool + record.nameOffset, record.nameLength);
+}
+
+bool MappedGraph::stationCoordinates(int id, double& x, double& y) const {
+    if (!stationExists(id) || !stationTable[stationSlots[id]].hasCoordinates) return false;
+    x = stationTable[stationSlots[id]].x;
+    y = stationTable[stationSlots[id]].y;
+    return true;
+}
+
+int MappedGraph::getRouteWeight(int src, int dest) const {
+    if (base == nullptr || src < 0 || src >= header->numVertices) return -1;
+    for (int e = offsets[src]; e < offsets[src + 1]; e++) {
+        if (targets[e] == dest) return weights[e];
+    }
+    return -1;
+}
+
+// BFS Implementation - Time: O(V+E), Space: O(V)
+// Same visit order as Graph::BFS and CSRGraph::BFS
+vector<int> MappedGraph::BFS(int startVertex) const {
+    vector<int> result;
+    if (base == nullptr || startVertex < 0 || startVertex >= header->numVertices) return result;
+    
+    vector<bool> visited(header->numVertices, false);
+    visited[startVertex] = true;
+    result.push_back(startVertex);
+    
+    for (size_t head = 0; head < result.size(); head++) {
+        int v = result[head];
+        for (int e = offsets[v]; e < offsets[v + 1]; e++) {
+            int w = targets[e];
+            if (!visited[w]) {
+                visited[w] = true;
+                result.push_back(w);
+            }
+        }
+    }
+    
+    return result;
+}
+
+// Dijkstra's Algorithm - Time: O((V+E) log V) with indexed min-heap, Space: O(V)
+// The CSRGraph implementation over the mapped arrays, so the path is the same
+// as CSRGraph::shortestPath on the network the file was written from
+vector<int> MappedGraph::shortestPath(int src, int dest, int* distance) const {
+    return CSRGraph::dijkstra(offsets, targets, weights, getNumVertices(), src, dest, distance);
+}
@@ -1,18 +1,19 @@
 #include "HashTable.h"
+#include "Logger.h"
 #include <iostream>
 
-HashTable::HashTable() : numVehicles(0) {
+ChainedHashTable::ChainedHashTable() : numVehicles(0) {
     // VehicleList objects are default constructed (head = nullptr)
 }
 
 // Insert - Average Time: O(1), Worst: O(n), Space: O(1)
-void HashTable::insert(Vehicle vehicle) {
+void ChainedHashTable::insert(Vehicle vehicle) {
     int index = hashFunction(vehicle.id);
     
     // Check if vehicle already exists
     Vehicle* existing = table[index].find(vehicle.id);
     if (existing != nullptr) {
-        cout << "Vehicle with ID " << vehicle.id << " already exists! Updating..." << endl;
+        LOG_INFO("Vehicle with ID " << vehicle.id << " already exists! Updating...");
         existing->type = vehicle.type;
         existing->model = vehicle.model;
         existing->capacity = vehicle.capacity;
@@ -25,35 +26,48 @@ void HashTable::insert(Vehicle vehicle) {
                                       vehicle.capacity, vehicle.speed);
     table[index].push_back(newVehicle);
     numVehicles++;
-    cout << "Vehicle " << vehicle.id << " (" << vehicle.type << " - " 
-         << vehicle.model << ") inserted successfully!" << endl;
+    LOG_INFO("Vehicle " << vehicle.id << " (" << vehicle.type << " - " 
+             << vehicle.model << ") inserted successfully!");
+}
+
+// Insert Batch - same update rule as insert, without per-record output;
+// negative IDs (no bucket) are skipped
+// Average Time: O(batch), Worst: O(batch * n), Space: O(batch)
+int ChainedHashTable::insertBatch(const vector<Vehicle>& vehicles) {
+    int added = 0;
+    for (size_t i = 0; i < vehicles.size(); i++) {
+        if (vehicles[i].id < 0) continue;
+        if (table[hashFunction(vehicles[i].id)].upsert(vehicles[i])) added++;
+    }
+    numVehicles += added;
+    return added;
 }
 
 // Search - Average Time: O(1), Worst: O(n), Space: O(1)
-Vehicle* HashTable::search(int id) {
+Vehicle* ChainedHashTable::search(int id) {
     int index = hashFunction(id);
     return table[index].find(id);
 }
 
 // Remove - Average Time: O(1), Worst: O(n), Space: O(1)
-bool HashTable::remove(int id) {
+bool ChainedHashTable::remove(int id) {
     int index = hashFunction(id);
     
     if (table[index].remove(id)) {
         numVehicles--;
-        cout << "Vehicle " << id << " removed successfully!" << endl;
+        LOG_INFO("Vehicle " << id << " removed successfully!");
         return true;
     }
     
-    cout << "Vehicle " << id << " not found!" << endl;
+    LOG_WARNING("Vehicle " << id << " not found!");
     return false;
 }
 
 // Display - Time: O(n), Space: O(1)
-void HashTable::display() const {
-    cout << "\n=== Vehicle Database ===" << endl;
+void ChainedHashTable::display() const {
+    cout << "\n=== Vehicle Database ===\n";
     if (numVehicles == 0) {
-        cout << "No vehicles in database." << endl;
+        cout << "No vehicles in database.\n";
         return;
     }
     
@@ -66,35 +80,35 @@ void HashTable::display() const {
                  << " | Type: " << current->type
                  << " | Model: " << current->model
                  << " | Capacity: " << current->capacity
-                 << " | Speed: " << current->speed << " km/h" << endl;
+                 << " | Speed: " << current->speed << " km/h\n";
             current = current->next;
         }
     }
-    cout << "\nTotal vehicles: " << numVehicles << endl;
-    cout << "Load factor: " << getLoadFactor() << endl;
+    cout << "\nTotal vehicles: " << numVehicles << '\n';
+    cout << "Load factor: " << getLoadFactor() << '\n';
 }
 
-void HashTable::displayVehicle(int id) const {
+void ChainedHashTable::displayVehicle(int id) const {
     int index = hashFunction(id);
     Vehicle* vehicle = table[index].find(id);
     
     if (vehicle != nullptr) {
-        cout << "\n=== Vehicle Details ===" << endl;
-        cout << "ID: " << vehicle->id << endl;
-        cout << "Type: " << vehicle->type << endl;
-        cout << "Model: " << vehicle->model << endl;
-        cout << "Capacity: " << vehicle->capacity << " passengers" << endl;
-        cout << "Speed: " << vehicle->speed << " km/h" << endl;
+        cout << "\n=== Vehicle Details ===\n";
+        cout << "ID: " << vehicle->id << '\n';
+        cout << "Type: " << vehicle->type << '\n';
+        cout << "Model: " << vehicle->model << '\n';
+        cout << "Capacity: " << vehicle->capacity << " passengers\n";
+        cout << "Speed: " << vehicle->speed << " km/h\n";
     } else {
-        cout << "Vehicle " << id << " not found!" << endl;
+        cout << "Vehicle " << id << " not found!\n";
     }
 }
 
-double HashTable::getLoadFactor() const {
+double ChainedHashTable::getLoadFactor() const {
     return (double)numVehicles / TABLE_SIZE;
 }
 
-int HashTable::getLongestChain() const {
+int ChainedHashTable::getLongestChain() const {
     int maxChain = 0;
     for (int i = 0; i < TABLE_SIZE; i++) {
         int chainSize = table[i].size();
@@ -105,3 +119,412 @@ int HashTable::getLongestChain() const {
     return maxChain;
 }
 
+// ==================== OPEN ADDRESSING ====================
+
+const unsigned char HashTable::EMPTY;
+const unsigned char HashTable::DELETED;
+const int HashTable::GROUP_SIZE;
+
+static const unsigned long long GROUP_LSB = 0x0101010101010101ULL;
+static const unsigned long long GROUP_MSB = 0x8080808080808080ULL;
+
+// Metadata bytes of one group as a word, byte i in bits 8i..8i+7
+static inline unsigned long long loadGroup(const unsigned char* bytes) {
+    unsigned long long word = 0;
+    for (int i = 7; i >= 0; i--) {
+        word = (word << 8) | bytes[i];
+    }
+    return word;
+}
+
+// High bit of every byte equal to tag (full slots only; the rare false
+// positive is ruled out by the ID comparison)
+static inline unsigned long long matchTag(unsigned long long word, unsigned char tag) {
+    unsigned long long x = word ^ (GROUP_LSB * tag);
+    return (x - GROUP_LSB) & ~x & GROUP_MSB;
+}
+
+// EMPTY is 10000000 and DELETED 11111110: bit 7 set and bit 1 clear only for EMPTY
+static inline unsigned long long matchEmpty(unsigned long long word) {
+    return word & ~(word << 6) & GROUP_MSB;
+}
+
+static inline int firstByte(unsigned long long mask) {
+    int b = 0;
+    while (!(mask & 0x80ULL)) {
+        mask >>= 8;
+        b++;
+    }
+    return b;
+}
+
+HashTable::HashTable(double loadFactor, int initialCapacity)
+    : capacity(GROUP_SIZE), tombstones(0), maxLoadFactor(loadFactor) {
+    if (maxLoadFactor < 0.1 || maxLoadFactor > 0.95) maxLoadFactor = 0.875;
+    while (capacity < initialCapacity && capacity < (1 << 30)) capacity *= 2;
+    control.assign(capacity, EMPTY);
+    slotIndex.assign(capacity, -1);
+}
+
+unsigned long long HashTable::hashKey(int key) {
+    unsigned long long hash = (unsigned int)key * 0x9E3779B97F4A7C15ULL;
+    return hash ^ (hash >> 29);
+}
+
+// Find Slot - Average Time: O(1), Space: O(1)
+int HashTable::findSlot(int id, int* groupsProbed) const {
+    unsigned long long hash = hashKey(id);
+    unsigned char tag = hash & 0x7F;
+    int groupMask = capacity / GROUP_SIZE - 1;
+    int group = (hash >> 7) & groupMask;
+    for (int step = 1; step <= groupMask + 1; step++) {
+        if (groupsProbed != nullptr) *groupsProbed = step;
+        unsigned long long word = loadGroup(&control[group * GROUP_SIZE]);
+        unsigned long long match = matchTag(word, tag);
+        while (match != 0) {
+            int slot = group * GROUP_SIZE + firstByte(match);
+            if (vehicles[slotIndex[slot]].id == id) return slot;
+            match &= match - 1;
+        }
+        if (matchEmpty(word) != 0) return -1;
+        group = (group + step) & groupMask;
+    }
+    return -1;
+}
+
+int HashTable::findInsertSlot(unsigned long long hash) const {
+    int groupMask = capacity / GROUP_SIZE - 1;
+    int group = (hash >> 7) & groupMask;
+    for (int step = 1; ; step++) {
+        unsigned long long free = loadGroup(&control[group * GROUP_SIZE]) & GROUP_MSB;
+        if (free != 0) return group * GROUP_SIZE + firstByte(free);
+        group = (group + step) & groupMask;
+    }
+}
+
+// Rehash - Time: O(capacity + n), Space: O(capacity)
+void HashTable::rehash(int newCapacity) {
+    capacity = newCapacity;
+    tombstones = 0;
+    control.assign(capacity, EMPTY);
+    slotIndex.assign(capacity, -1);
+    for (size_t i = 0; i < vehicles.size(); i++) {
+        unsigned long long hash = hashKey(vehicles[i].id);
+        int slot = findInsertSlot(hash);
+        control[slot] = hash & 0x7F;
+        slotIndex[slot] = i;
+    }
+}
+
+void HashTable::reserveForInsert() {
+    long long used = (long long)vehicles.size() + tombstones + 1;
+    if (used <= capacity * maxLoadFactor) return;
+    if ((vehicles.size() + 1) * 2 <= capacity * maxLoadFactor) {
+        rehash(capacity);       // Mostly tombstones: clean up in place
+    } else {
+        rehash(capacity * 2);
+    }
+}
+
+void HashTable::reserve(int numVehicles) {
+    int needed = capacity;
+    while (needed * maxLoadFactor < numVehicles && needed < (1 << 30)) needed *= 2;
+    if (needed > capacity) rehash(needed);
+}
+
+void HashTable::addNew(const Vehicle& vehicle, bool indexRanges) {
+    reserveForInsert();
+    unsigned long long hash = hashKey(vehicle.id);
+    int slot = findInsertSlot(hash);
+    if (control[slot] == DELETED) tombstones--;
+    control[slot] = hash & 0x7F;
+    slotIndex[slot] = vehicles.size();
+    vehicles.push_back(Vehicle(vehicle.id, vehicle.type, vehicle.model, vehicle.capacity, vehicle.speed));
+    
+    int category = typeIndex.intern(vehicle.type);
+    typeOf.push_back(category);
+    typePosition.push_back(typeIndex.add(category, vehicles.size() - 1));
+    if (indexRanges) {
+        capacityIndex.insert(vehicle.capacity, vehicle.id);
+        speedIndex.insert(vehicle.speed, vehicle.id);
+    }
+}
+
+// Drop dense vehicle index from its type's member list - Time: O(1)
+void HashTable::removeFromType(int index) {
+    int moved = typeIndex.removeAt(typeOf[index], typePosition[index]);
+    if (moved != -1) typePosition[moved] = typePosition[index];
+}
+
+// Assign At - Time: O(1) if the indexed fields are unchanged, else O(log n + block)
+void HashTable::assignAt(int index, const Vehicle& vehicle, bool updateRanges) {
+    Vehicle& existing = vehicles[index];
+    if (existing.type != vehicle.type) {
+        removeFromType(index);
+        typeOf[index] = typeIndex.intern(vehicle.type);
+        typePosition[index] = typeIndex.add(typeOf[index], index);
+        existing.type = vehicle.type;
+    }
+    if (!updateRanges) {
+        existing.capacity = vehicle.capacity;
+        existing.speed = vehicle.speed;
+    }
+    if (existing.capacity != vehicle.capacity) {
+        capacityIndex.remove(existing.capacity, existing.id);
+        capacityIndex.insert(vehicle.capacity, existing.id);
+        existing.capacity = vehicle.capacity;
+    }
+    if (!(existing.speed == vehicle.speed)) {  // Also true for NaN, whose removal still finds it
+        speedIndex.remove(existing.speed, existing.id);
+        speedIndex.insert(vehicle.speed, existing.id);
+        existing.speed = vehicle.speed;
+    }
+    existing.model = vehicle.model;
+}
+
+// Remove the vehicle in slot; the last vehicle moves into its dense position
+void HashTable::removeAt(int slot) {
+    int index = slotIndex[slot];
+    int last = vehicles.size() - 1;
+    removeFromType(index);
+    capacityIndex.remove(vehicles[index].capacity, vehicles[index].id);
+    speedIndex.remove(vehicles[index].speed, vehicles[index].id);
+    if (index != last) {
+        int movedSlot = findSlot(vehicles[last].id);
+        vehicles[index] = vehicles[last];
+        slotIndex[movedSlot] = index;
+        typeOf[index] = typeOf[last];
+        typePosition[index] = typePosition[last];
+        typeIndex.replaceAt(typeOf[index], typePosition[index], index);
+    }
+    vehicles.pop_back();
+    typeOf.pop_back();
+    typePosition.pop_back();
+    slotIndex[slot] = -1;
+    
+    // A group that still has an EMPTY slot never let a probe pass through it,
+    // so this slot can be EMPTY too; otherwise a tombstone keeps probes going
+    int group = slot / GROUP_SIZE;
+    if (matchEmpty(loadGroup(&control[group * GROUP_SIZE])) != 0) {
+        control[slot] = EMPTY;
+    } else {
+        control[slot] = DELETED;
+        tombstones++;
+    }
+}
+
+// Insert - Average Time: O(1) amortized, Space: O(1)
+void HashTable::insert(Vehicle vehicle) {
+    int slot = findSlot(vehicle.id);
+    if (slot != -1) {
+        LOG_INFO("Vehicle with ID " << vehicle.id << " already exists! Updating...");
+        assignAt(slotIndex[slot], vehicle);
+        return;
+    }
+    
+    addNew(vehicle);
+    LOG_INFO("Vehicle " << vehicle.id << " (" << vehicle.type << " - "
+             << vehicle.model << ") inserted successfully!");
+}
+
+// Insert Batch - same update rule as insert, without per-record output
+// Average Time: O(batch) after one resize, Space: O(batch)
+int HashTable::insertBatch(const vector<Vehicle>& batch) {
+    reserve(vehicles.size() + batch.size());
+    int firstNew = vehicles.size();
+    int added = 0;
+    for (size_t i = 0; i < batch.size(); i++) {
+        int slot = findSlot(batch[i].id);
+        if (slot != -1) {
+            // Vehicles added by this batch are not in the range indexes yet
+            assignAt(slotIndex[slot], batch[i], slotIndex[slot] < firstNew);
+        } else {
+            addNew(batch[i], false);
+            added++;
+        }
+    }
+    
+    // New vehicles enter the range indexes together (sorted merge when large)
+    vector<OrderedIndex::Entry> capacities(added);
+    vector<OrderedIndex::Entry> speeds(added);
+    for (int i = 0; i < added; i++) {
+        const Vehicle& vehicle = vehicles[firstNew + i];
+        capacities[i].key = vehicle.capacity;
+        capacities[i].id = vehicle.id;
+        speeds[i].key = vehicle.speed;
+        speeds[i].id = vehicle.id;
+    }
+    capacityIndex.insertBatch(capacities);
+    speedIndex.insertBatch(speeds);
+    return added;
+}
+
+// Search - Average Time: O(1), Space: O(1)
+const Vehicle* HashTable::search(int id) const {
+    int slot = findSlot(id);
+    return (slot != -1) ? &vehicles[slotIndex[slot]] : nullptr;
+}
+
+// Remove - Average Time: O(1), Space: O(1)
+bool HashTable::remove(int id) {
+    int slot = findSlot(id);
+    if (slot != -1) {
+        removeAt(slot);
+        LOG_INFO("Vehicle " << id << " removed successfully!");
+        return true;
+    }
+    
+    LOG_WARNING("Vehicle " << id << " not found!");
+    return false;
+}
+
+// Update - replaces the stored fields of an existing vehicle
+// Average Time: O(1), O(log n) per changed indexed field, Space: O(1)
+bool HashTable::update(const Vehicle& vehicle) {
+    int slot = findSlot(vehicle.id);
+    if (slot == -1) return false;
+    assignAt(slotIndex[slot], vehicle);
+    return true;
+}
+
+// Update Telemetry - capacity and speed only
+bool HashTable::updateTelemetry(int id, int capacity, double speed) {
+    int slot = findSlot(id);
+    if (slot == -1) return false;
+    Vehicle changed = vehicles[slotIndex[slot]];
+    changed.capacity = capacity;
+    changed.speed = speed;
+    assignAt(slotIndex[slot], changed);
+    return true;
+}
+
+void HashTable::clear() {
+    vehicles.clear();
+    control.assign(capacity, EMPTY);
+    slotIndex.assign(capacity, -1);
+    tombstones = 0;
+    typeIndex.clear();
+    capacityIndex.clear();
+    speedIndex.clear();
+    typeOf.clear();
+    typePosition.clear();
+}
+
+vector<int> HashTable::findByType(const string& type) const {
+    VehicleFilter filter;
+    filter.type = type;
+    return findVehicles(filter);
+}
+
+vector<int> HashTable::findByCapacity(int minCapacity, int maxCapacity) const {
+    vector<int> ids;
+    capacityIndex.findRange(minCapacity, maxCapacity, ids);
+    return ids;
+}
+
+vector<int> HashTable::findBySpeed(double minSpeed, double maxSpeed) const {
+    vector<int> ids;
+    speedIndex.findRange(minSpeed, maxSpeed, ids);
+    return ids;
+}
+
+int HashTable::countByType(const string& type) const {
+    int category = typeIndex.find(type);
+    return (category == -1) ? 0 : typeIndex.getMembers(category).size();
+}
+
+bool HashTable::matches(int index, int category, const VehicleFilter& filter) const {
+    const Vehicle& vehicle = vehicles[index];
+    double speed = (vehicle.speed != vehicle.speed) ? HUGE_VAL : vehicle.speed;  // As indexed
+    return (category == -1 || typeOf[index] == category) &&
+           vehicle.capacity >= filter.minCapacity && vehicle.capacity <= filter.maxCapacity &&
+           speed >= filter.minSpeed && speed <= filter.maxSpeed;
+}
+
+// Find Vehicles - the type list or the narrower range index supplies the
+// candidates; only they are read to check the remaining conditions
+// Time: O(log n + candidates), Space: O(candidates)
+vector<int> HashTable::findVehicles(const VehicleFilter& filter) const {
+    vector<int> ids;
+    int category = -1;
+    int typeCount = vehicles.size();  // No type given: every vehicle
+    if (!filter.type.empty()) {
+        category = typeIndex.find(filter.type);
+        if (category == -1) return ids;
+        typeCount = typeIndex.getMembers(category).size();
+    }
+    int capacityCount = capacityIndex.countRange(filter.minCapacity, filter.maxCapacity);
+    int speedCount = speedIndex.countRange(filter.minSpeed, filter.maxSpeed);
+    
+    // A range candidate is an ID and costs a hash lookup before its record can
+    // be checked; a type member is a dense position, read directly
+    if (typeCount <= capacityCount * RANGE_CANDIDATE_COST && typeCount <= speedCount * RANGE_CANDIDATE_COST) {
+        for (int i = 0; i < typeCount; i++) {
+            int index = (category == -1) ? i : typeIndex.getMembers(category)[i];
+            if (matches(index, category, filter)) ids.push_back(vehicles[index].id);
+        }
+        return ids;
+    }
+    
+    vector<int> candidates;
+    bool byCapacity = capacityCount <= speedCount;
+    if (byCapacity) capacityIndex.findRange(filter.minCapacity, filter.maxCapacity, candidates);
+    else speedIndex.findRange(filter.minSpeed, filter.maxSpeed, candidates);
+    
+    // Nothing else to check: the IDs are the answer and no record is read
+    if (category == -1 && (byCapacity ? speedCount : capacityCount) == (int)vehicles.size()) return candidates;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        if (matches(slotIndex[findSlot(candidates[i])], category, filter)) ids.push_back(candidates[i]);
+    }
+    return ids;
+}
+
+// Display - Time: O(n), Space: O(1)
+void HashTable::display() const {
+    cout << "\n=== Vehicle Database ===\n";
+    if (vehicles.empty()) {
+        cout << "No vehicles in database.\n";
+        return;
+    }
+    
+    for (size_t i = 0; i < vehicles.size(); i++) {
+        const Vehicle& current = vehicles[i];
+        cout << i + 1 << ". ID: " << current.id
+             << " | Type: " << current.type
+             << " | Model: " << current.model
+             << " | Capacity: " << current.capacity
+             << " | Speed: " << current.speed << " km/h\n";
+    }
+    cout << "\nTotal vehicles: " << vehicles.size() << '\n';
+    cout << "Load factor: " << getLoadFactor() << '\n';
+}
+
+void HashTable::displayVehicle(int id) const {
+    int slot = findSlot(id);
+    if (slot != -1) {
+        const Vehicle& vehicle = vehicles[slotIndex[slot]];
+        cout << "\n=== Vehicle Details ===\n";
+        cout << "ID: " << vehicle.id << '\n';
+        cout << "Type: " << vehicle.type << '\n';
+        cout << "Model: " << vehicle.model << '\n';
+        cout << "Capacity: " << vehicle.capacity << " passengers\n";
+        cout << "Speed: " << vehicle.speed << " km/h\n";
+    } else {
+        cout << "Vehicle " << id << " not found!\n";
+    }
+}
+
+double HashTable::getLoadFactor() const {
+    return (double)vehicles.size() / capacity;
+}
+
+// Longest Probe - Time: O(n), Space: O(1)
+int HashTable::getLongestProbe() const {
+    int longest = 0;
+    for (size_t i = 0; i < vehicles.size(); i++) {
+        int groups = 0;
+        findSlot(vehicles[i].id, &groups);
+        if (groups > longest) longest = groups;
+    }
+    return longest;
+}
@@ -1,5 +1,6 @@
 #include "Heap.h"
 #include <iostream>
+#include <climits>
 
 Heap::Heap() {
     heap.clear();
@@ -80,11 +81,11 @@ int Heap::getSize() const {
 // Display - Time: O(n), Space: O(1)
 void Heap::display() const {
     if (isEmpty()) {
-        cout << "Heap is empty!" << endl;
+        cout << "Heap is empty!\n";
         return;
     }
     
-    cout << "\n=== Vehicle Priority Queue (Min-Heap) ===" << endl;
+    cout << "\n=== Vehicle Priority Queue (Min-Heap) ===\n";
     vector<VehiclePriority> temp = heap;
     int position = 1;
     
@@ -97,7 +98,7 @@ void Heap::display() const {
         cout << position << ". Vehicle ID: " << min.vehicleId
              << " | Type: " << min.type
              << " | Speed: " << min.speed << " km/h"
-             << " | Capacity: " << min.capacity << endl;
+             << " | Capacity: " << min.capacity << '\n';
         
         // Manual removal (no remove_if)
         for (auto it = temp.begin(); it != temp.end(); ) {
@@ -175,3 +176,130 @@ void Heap::heapSort(vector<VehiclePriority>& arr) {
     }
 }
 
+
+// ==================== Indexed Min-Heap ====================
+
+IndexedMinHeap::IndexedMinHeap(int capacity) {
+    reset(capacity);
+}
+
+// Reset - Time: O(capacity), Space: O(capacity)
+void IndexedMinHeap::reset(int capacity) {
+    heap.clear();
+    position.assign(capacity, -1);
+    key.assign(capacity, 0);
+}
+
+// Clear - Time: O(size), Space: O(1)
+// Only the vertices still in the heap are touched, so repeated small
+// searches on a large graph do not pay O(capacity) per search.
+void IndexedMinHeap::clear() {
+    for (size_t i = 0; i < heap.size(); i++) {
+        position[heap[i]] = -1;
+    }
+    heap.clear();
+}
+
+bool IndexedMinHeap::lessThan(int i, int j) const {
+    int a = heap[i];
+    int b = heap[j];
+    if (key[a] != key[b]) {
+        return key[a] < key[b];
+    }
+    return a < b;
+}
+
+void IndexedMinHeap::swapNodes(int i, int j) {
+    // Manual swap
+    int temp = heap[i];
+    heap[i] = heap[j];
+    heap[j] = temp;
+    position[heap[i]] = i;
+    position[heap[j]] = j;
+}
+
+// Heapify Up - Time: O(log n), Space: O(1)
+void IndexedMinHeap::heapifyUp(int index) {
+    while (index > 0 && lessThan(index, parent(index))) {
+        swapNodes(index, parent(index));
+        index = parent(index);
+    }
+}
+
+// Heapify Down - Time: O(log n), Space: O(1)
+void IndexedMinHeap::heapifyDown(int index) {
+    int n = heap.size();
+    while (true) {
+        int smallest = index;
+        int left = leftChild(index);
+        int right = rightChild(index);
+        
+        if (left < n && lessThan(left, smallest)) {
+            smallest = left;
+        }
+        if (right < n && lessThan(right, smallest)) {
+            smallest = right;
+        }
+        
+        if (smallest == index) break;
+        swapNodes(index, smallest);
+        index = smallest;
+    }
+}
+
+// Insert or Decrease Key - Time: O(log n), Space: O(1)
+// A priority that is not lower than the current key is ignored.
+void IndexedMinHeap::insert(int vertex, int priority) {
+    if (vertex < 0) return;
+    if (vertex >= static_cast<int>(position.size())) {
+        position.resize(vertex + 1, -1);
+        key.resize(vertex + 1, 0);
+    }
+    
+    if (position[vertex] == -1) {
+        key[vertex] = priority;
+        heap.push_back(vertex);
+        position[vertex] = heap.size() - 1;
+        heapifyUp(position[vertex]);
+    } else if (priority < key[vertex]) {
+        key[vertex] = priority;
+        heapifyUp(position[vertex]);
+    }
+}
+
+// Extract Min - Time: O(log n), Space: O(1)
+int IndexedMinHeap::extractMin() {
+    if (isEmpty()) {
+        return -1;
+    }
+    
+    int min = heap[0];
+    swapNodes(0, heap.size() - 1);
+    heap.pop_back();
+    position[min] = -1;
+    
+    if (!isEmpty()) {
+        heapifyDown(0);
+    }
+    
+    return min;
+}
+
+int IndexedMinHeap::peekKey() const {
+    if (isEmpty()) {
+        return INT_MAX;
+    }
+    return key[heap[0]];
+}
+
+bool IndexedMinHeap::contains(int vertex) const {
+    return vertex >= 0 && vertex < static_cast<int>(position.size()) && position[vertex] != -1;
+}
+
+bool IndexedMinHeap::isEmpty() const {
+    return heap.empty();
+}
+
+int IndexedMinHeap::getSize() const {
+    return heap.size();
+}
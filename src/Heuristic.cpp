@@ -0,0 +1,345 @@
+#include "Heuristic.h"
+#include "Graph.h"
+#include <cmath>
+#include <climits>
+#include <fstream>
+
+static const char LANDMARK_MAGIC[4] = {'I', 'T', 'L', 'M'};
+static const int LANDMARK_VERSION = 1;
+
+// Builds the coordinate tables and scans every route for the maximum speed
+// Time: O(V+E), Space: O(V)
+CoordinateHeuristic::CoordinateHeuristic(const Graph& graph, Metric m)
+    : metric(m), costPerUnit(0.0) {
+    int n = graph.getNumVertices();
+    xs.assign(n, 0.0);
+    ys.assign(n, 0.0);
+    located.assign(n, false);
+    
+    vector<Station> stations = graph.getAllStations();
+    for (size_t i = 0; i < stations.size(); i++) {
+        if (stations[i].hasCoordinates) {
+            xs[stations[i].id] = stations[i].x;
+            ys[stations[i].id] = stations[i].y;
+            located[stations[i].id] = true;
+        }
+    }
+    
+    // Maximum speed = max(length / weight). A zero-weight route with positive
+    // length means unbounded speed, and a route touching a station without
+    // coordinates cannot be bounded at all; either way only 0 is admissible.
+    CSRGraph csr = graph.freeze();
+    double maxSpeed = 0.0;
+    bool unbounded = false;
+    for (int u = 0; u < n && !unbounded; u++) {
+        for (int e = csr.edgeBegin(u); e < csr.edgeEnd(u); e++) {
+            int v = csr.edgeTarget(e);
+            if (!located[u] || !located[v]) {
+                unbounded = true;
+                break;
+            }
+            double length = distance(u, v);
+            if (length <= 0.0) continue;
+            if (csr.edgeWeight(e) <= 0) {
+                unbounded = true;
+                break;
+            }
+            double speed = length / csr.edgeWeight(e);
+            if (speed > maxSpeed) maxSpeed = speed;
+        }
+    }
+    
+    if (!unbounded && maxSpeed > 0.0) {
+        // Shrink slightly so rounding can never push the estimate above the true cost
+        costPerUnit = (1.0 - 1e-9) / maxSpeed;
+    }
+}
+
+double CoordinateHeuristic::distance(int a, int b) const {
+    if (metric == EUCLIDEAN) {
+        double dx = xs[a] - xs[b];
+        double dy = ys[a] - ys[b];
+        return sqrt(dx * dx + dy * dy);
+    }
+    
+    // Haversine formula on a spherical earth (radius 6371 km)
+    const double toRadians = 3.14159265358979323846 / 180.0;
+    double lat1 = xs[a] * toRadians;
+    double lat2 = xs[b] * toRadians;
+    double dLat = lat2 - lat1;
+    double dLon = (ys[b] - ys[a]) * toRadians;
+    double h = sin(dLat / 2) * sin(dLat / 2) +
+               cos(lat1) * cos(lat2) * sin(dLon / 2) * sin(dLon / 2);
+    if (h > 1.0) h = 1.0;
+    return 2.0 * 6371.0 * asin(sqrt(h));
+}
+
+// Estimate - Time: O(1), Space: O(1)
+int CoordinateHeuristic::estimate(int vertex, int target) const {
+    if (vertex < 0 || target < 0 || vertex >= (int)located.size() || target >= (int)located.size()) return 0;
+    if (!located[vertex] || !located[target] || costPerUnit == 0.0) return 0;
+    return (int)floor(distance(vertex, target) * costPerUnit);
+}
+
+double CoordinateHeuristic::getMaxSpeed() const {
+    return costPerUnit > 0.0 ? (1.0 - 1e-9) / costPerUnit : 0.0;
+}
+
+// ==================== LANDMARK (ALT) HEURISTIC ====================
+
+// Full single-source Dijkstra over a CSR snapshot - Time: O((V+E) log V), Space: O(V)
+// dist receives V entries (INT_MAX = unreachable); parent and order, when given,
+// receive the shortest path tree and the settle order.
+static void landmarkSearch(const CSRGraph& graph, int source, int* dist,
+                           vector<int>* parent, vector<int>* order) {
+    int n = graph.getNumVertices();
+    for (int v = 0; v < n; v++) dist[v] = INT_MAX;
+    if (parent) parent->assign(n, -1);
+    if (order) order->clear();
+    
+    IndexedMinHeap queue(n);
+    dist[source] = 0;
+    queue.insert(source, 0);
+    while (!queue.isEmpty()) {
+        int u = queue.extractMin();
+        if (order) order->push_back(u);
+        for (int e = graph.edgeBegin(u); e < graph.edgeEnd(u); e++) {
+            int v = graph.edgeTarget(e);
+            int newDist = dist[u] + graph.edgeWeight(e);
+            if (newDist < dist[v]) {
+                dist[v] = newDist;
+                if (parent) (*parent)[v] = u;
+                queue.insert(v, newDist);
+            }
+        }
+    }
+}
+
+LandmarkHeuristic::LandmarkHeuristic() : numVertices(0), numLandmarks(0), fingerprint(0) {}
+
+LandmarkHeuristic::LandmarkHeuristic(const Graph& graph, int k, Selection selection)
+    : numVertices(0), numLandmarks(0), fingerprint(0) {
+    build(graph, k, selection);
+}
+
+// FNV-1a hash of the CSR arrays - Time: O(V+E)
+unsigned long long LandmarkHeuristic::computeFingerprint(const CSRGraph& forward) {
+    unsigned long long hash = 14695981039346656037ULL;
+    int n = forward.getNumVertices();
+    hash = (hash ^ (unsigned int)n) * 1099511628211ULL;
+    for (int u = 0; u < n; u++) {
+        hash = (hash ^ (unsigned int)forward.degree(u)) * 1099511628211ULL;
+        for (int e = forward.edgeBegin(u); e < forward.edgeEnd(u); e++) {
+            hash = (hash ^ (unsigned int)forward.edgeTarget(e)) * 1099511628211ULL;
+            hash = (hash ^ (unsigned int)forward.edgeWeight(e)) * 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+// Appends one landmark row to both tables
+void LandmarkHeuristic::addLandmark(int vertex, const CSRGraph& forward, const CSRGraph& backward) {
+    landmarks.push_back(vertex);
+    fromLandmark.resize((size_t)(numLandmarks + 1) * numVertices);
+    toLandmark.resize((size_t)(numLandmarks + 1) * numVertices);
+    landmarkSearch(forward, vertex, &fromLandmark[(size_t)numLandmarks * numVertices], nullptr, nullptr);
+    landmarkSearch(backward, vertex, &toLandmark[(size_t)numLandmarks * numVertices], nullptr, nullptr);
+    numLandmarks++;
+}
+
+// Farthest - candidate maximising its round-trip distance to the nearest landmark
+// (unreachable counts as infinitely far). Time: O(kV). Returns -1 if none is left.
+int LandmarkHeuristic::selectFarthest(const vector<bool>& isStation) const {
+    int best = -1;
+    long long bestScore = 0;
+    for (int v = 0; v < numVertices; v++) {
+        if (!isStation[v]) continue;
+        long long score = LLONG_MAX;
+        for (int l = 0; l < numLandmarks && score > bestScore; l++) {
+            int from = fromLandmark[(size_t)l * numVertices + v];
+            int to = toLandmark[(size_t)l * numVertices + v];
+            long long roundTrip = (from == INT_MAX || to == INT_MAX) ? LLONG_MAX / 2 : (long long)from + to;
+            if (roundTrip < score) score = roundTrip;
+        }
+        if (score > bestScore) {
+            bestScore = score;
+            best = v;
+        }
+    }
+    return best;
+}
+
+// Avoid - grows a shortest path tree from root, weights every vertex by how
+// badly the current landmarks bound d(root, v), sums the weights per subtree
+// (zero for subtrees that already contain a landmark) and walks down the
+// heaviest subtrees to a leaf. Time: O((V+E) log V + kV). Returns -1 if every
+// subtree is already covered.
+int LandmarkHeuristic::selectAvoid(const CSRGraph& forward, const vector<bool>& isStation, int root) const {
+    vector<int> dist(numVertices);
+    vector<int> parent;
+    vector<int> order;
+    landmarkSearch(forward, root, &dist[0], &parent, &order);
+    
+    vector<long long> size(numVertices, 0);
+    vector<bool> covered(numVertices, false);
+    vector<int> bestChild(numVertices, -1);
+    for (int l = 0; l < numLandmarks; l++) {
+        covered[landmarks[l]] = true;
+    }
+    
+    // Children are settled after their parent, so reverse settle order is bottom-up
+    for (int i = (int)order.size() - 1; i >= 0; i--) {
+        int v = order[i];
+        if (covered[v]) {
+            size[v] = 0;
+        } else {
+            size[v] += dist[v] - estimate(root, v);
+        }
+        int p = parent[v];
+        if (p == -1) continue;
+        if (covered[v]) {
+            covered[p] = true;
+        } else if (size[v] > 0) {
+            size[p] += size[v];
+            if (bestChild[p] == -1 || size[v] > size[bestChild[p]]) bestChild[p] = v;
+        }
+    }
+    
+    if (covered[root] || size[root] == 0) return -1;
+    int w = root;
+    while (bestChild[w] != -1) {
+        w = bestChild[w];
+    }
+    return isStation[w] ? w : -1;
+}
+
+// Build - Time: O(k (V+E) log V), Space: O(kV)
+void LandmarkHeuristic::build(const Graph& graph, int k, Selection selection) {
+    CSRGraph forward = graph.freeze();
+    CSRGraph backward = graph.freezeReverse();
+    numVertices = graph.getNumVertices();
+    numLandmarks = 0;
+    fingerprint = computeFingerprint(forward);
+    landmarks.clear();
+    fromLandmark.clear();
+    toLandmark.clear();
+    
+    // Only stations with at least one route can usefully anchor a landmark
+    vector<bool> isStation(numVertices, false);
+    vector<int> candidates;
+    for (int v = 0; v < numVertices; v++) {
+        if (graph.stationExists(v) && (forward.degree(v) > 0 || backward.degree(v) > 0)) {
+            isStation[v] = true;
+            candidates.push_back(v);
+        }
+    }
+    if (candidates.empty() || k <= 0) return;
+    
+    // First landmark: farthest reachable candidate from the lowest-numbered one
+    vector<int> dist(numVertices);
+    landmarkSearch(forward, candidates[0], &dist[0], nullptr, nullptr);
+    int first = candidates[0];
+    for (size_t i = 0; i < candidates.size(); i++) {
+        int v = candidates[i];
+        if (dist[v] != INT_MAX && dist[v] > dist[first]) first = v;
+    }
+    addLandmark(first, forward, backward);
+    
+    unsigned int seed = 12345;
+    while (numLandmarks < k) {
+        int next = -1;
+        if (selection == AVOID) {
+            seed = seed * 1103515245 + 12345;
+            int root = candidates[(seed >> 8) % candidates.size()];
+            next = selectAvoid(forward, isStation, root);
+        }
+        if (next == -1) next = selectFarthest(isStation);
+        if (next == -1) break;
+        addLandmark(next, forward, backward);
+    }
+}
+
+// Estimate - Time: O(k), Space: O(1)
+int LandmarkHeuristic::estimate(int vertex, int target) const {
+    if (vertex < 0 || target < 0 || vertex >= numVertices || target >= numVertices) return 0;
+    
+    int best = 0;
+    for (int l = 0; l < numLandmarks; l++) {
+        const int* from = &fromLandmark[(size_t)l * numVertices];
+        const int* to = &toLandmark[(size_t)l * numVertices];
+        if (from[target] != INT_MAX && from[vertex] != INT_MAX && from[target] - from[vertex] > best) {
+            best = from[target] - from[vertex];
+        }
+        if (to[vertex] != INT_MAX && to[target] != INT_MAX && to[vertex] - to[target] > best) {
+            best = to[vertex] - to[target];
+        }
+    }
+    return best;
+}
+
+bool LandmarkHeuristic::matches(const Graph& graph) const {
+    return numVertices == graph.getNumVertices() && fingerprint == computeFingerprint(graph.freeze());
+}
+
+// Save - header, landmark IDs, then both tables as flat int arrays
+bool LandmarkHeuristic::save(const string& filename) const {
+    ofstream out(filename.c_str(), ios::binary);
+    if (!out) return false;
+    
+    out.write(LANDMARK_MAGIC, 4);
+    out.write(reinterpret_cast<const char*>(&LANDMARK_VERSION), sizeof(int));
+    out.write(reinterpret_cast<const char*>(&numVertices), sizeof(int));
+    out.write(reinterpret_cast<const char*>(&numLandmarks), sizeof(int));
+    out.write(reinterpret_cast<const char*>(&fingerprint), sizeof(fingerprint));
+    if (numLandmarks > 0) {
+        out.write(reinterpret_cast<const char*>(&landmarks[0]), sizeof(int) * landmarks.size());
+        out.write(reinterpret_cast<const char*>(&fromLandmark[0]), sizeof(int) * fromLandmark.size());
+        out.write(reinterpret_cast<const char*>(&toLandmark[0]), sizeof(int) * toLandmark.size());
+    }
+    return out.good();
+}
+
+// Load - rejects files with a wrong header, a size that does not match the
+// header, or landmark IDs out of range
+bool LandmarkHeuristic::load(const string& filename) {
+    ifstream in(filename.c_str(), ios::binary);
+    if (!in) return false;
+    
+    char magic[4];
+    int version = 0, vertices = 0, count = 0;
+    unsigned long long hash = 0;
+    if (!in.read(magic, 4) || magic[0] != LANDMARK_MAGIC[0] || magic[1] != LANDMARK_MAGIC[1] ||
+        magic[2] != LANDMARK_MAGIC[2] || magic[3] != LANDMARK_MAGIC[3]) return false;
+    if (!in.read(reinterpret_cast<char*>(&version), sizeof(int)) || version != LANDMARK_VERSION) return false;
+    if (!in.read(reinterpret_cast<char*>(&vertices), sizeof(int)) || vertices < 0) return false;
+    if (!in.read(reinterpret_cast<char*>(&count), sizeof(int)) || count < 0 || count > vertices) return false;
+    if (!in.read(reinterpret_cast<char*>(&hash), sizeof(hash))) return false;
+    
+    // The payload size is fixed by the header; check it before allocating
+    streampos payloadStart = in.tellg();
+    in.seekg(0, ios::end);
+    long long payload = (long long)(in.tellg() - payloadStart);
+    long long expected = (long long)sizeof(int) * count * (1 + 2LL * vertices);
+    if (payload != expected) return false;
+    in.seekg(payloadStart);
+    
+    vector<int> ids(count);
+    vector<int> from((size_t)count * vertices);
+    vector<int> to((size_t)count * vertices);
+    if (count > 0) {
+        if (!in.read(reinterpret_cast<char*>(&ids[0]), sizeof(int) * ids.size()) ||
+            !in.read(reinterpret_cast<char*>(&from[0]), sizeof(int) * from.size()) ||
+            !in.read(reinterpret_cast<char*>(&to[0]), sizeof(int) * to.size())) return false;
+    }
+    for (int l = 0; l < count; l++) {
+        if (ids[l] < 0 || ids[l] >= vertices) return false;
+    }
+    
+    numVertices = vertices;
+    numLandmarks = count;
+    fingerprint = hash;
+    landmarks.swap(ids);
+    fromLandmark.swap(from);
+    toLandmark.swap(to);
+    return true;
+}
@@ -0,0 +1,112 @@
+#include "Logger.h"
+#include <iostream>
+#include <mutex>
+#include <atomic>
+#include <cstring>
+
+void ConsoleSink::write(LogLevel, const string& message) {
+    cout << message << '\n';
+}
+
+void ConsoleSink::flush() {
+    cout.flush();
+}
+
+BufferedWriter::BufferedWriter(FILE* target, size_t capacity)
+    : file(target), ownsFile(false), buffer(capacity > 0 ? capacity : 1), used(0) {}
+
+BufferedWriter::~BufferedWriter() {
+    close();
+}
+
+bool BufferedWriter::open(const string& filename, bool append) {
+    close();
+    file = fopen(filename.c_str(), append ? "ab" : "wb");
+    ownsFile = (file != nullptr);
+    return file != nullptr;
+}
+
+void BufferedWriter::close() {
+    flush();
+    if (ownsFile && file != nullptr) fclose(file);
+    file = nullptr;
+    ownsFile = false;
+}
+
+// Write - Time: O(length) amortized, one fwrite per buffer-full
+void BufferedWriter::write(const char* data, size_t length) {
+    if (file == nullptr) return;
+    if (used + length > buffer.size()) {
+        flush();
+        if (length >= buffer.size()) {
+            fwrite(data, 1, length, file);  // Larger than the buffer: no point copying
+            return;
+        }
+    }
+    memcpy(buffer.data() + used, data, length);
+    used += length;
+}
+
+void BufferedWriter::flush() {
+    if (file == nullptr) return;
+    if (used > 0) fwrite(buffer.data(), 1, used, file);
+    used = 0;
+    fflush(file);
+}
+
+void FileSink::write(LogLevel level, const string& message) {
+    writer.write("[");
+    writer.write(Logger::levelName(level));
+    writer.write("] ");
+    writer.write(message);
+    writer.write("\n", 1);
+}
+
+// Shared state; the level is atomic so disabled messages cost one load and no lock
+static ConsoleSink consoleSink;
+static LogSink* currentSink = &consoleSink;
+static atomic<int> currentLevel(LOG_LEVEL_INFO);
+static mutex logMutex;
+
+void Logger::setLevel(LogLevel level) {
+    currentLevel.store(level, memory_order_relaxed);
+}
+
+LogLevel Logger::getLevel() {
+    return (LogLevel)currentLevel.load(memory_order_relaxed);
+}
+
+bool Logger::isEnabled(LogLevel level) {
+    return level != LOG_LEVEL_OFF && (int)level >= currentLevel.load(memory_order_relaxed);
+}
+
+void Logger::setSink(LogSink* sink) {
+    lock_guard<mutex> lock(logMutex);
+    currentSink->flush();
+    currentSink = (sink != nullptr) ? sink : &consoleSink;
+}
+
+LogSink* Logger::getSink() {
+    lock_guard<mutex> lock(logMutex);
+    return currentSink;
+}
+
+void Logger::write(LogLevel level, const string& message) {
+    lock_guard<mutex> lock(logMutex);
+    currentSink->write(level, message);
+}
+
+void Logger::flush() {
+    lock_guard<mutex> lock(logMutex);
+    currentSink->flush();
+}
+
+const char* Logger::levelName(LogLevel level) {
+    switch (level) {
+        case LOG_LEVEL_DEBUG: return "DEBUG";
+        case LOG_LEVEL_INFO: return "INFO";
+        case LOG_LEVEL_WARNING: return "WARNING";
+        case LOG_LEVEL_ERROR: return "ERROR";
+        default: return "OFF";
+    }
+}
@@ -1,4 +1,5 @@
 #include "Queue.h"
+#include "Logger.h"
 #include <iostream>
 
 Queue::Queue() : front(nullptr), rear(nullptr), size(0) {}
@@ -18,14 +19,28 @@ void Queue::enqueue(Passenger passenger) {
         rear = newNode;
     }
     size++;
-    cout << "Passenger " << passenger.name << " (ID: " << passenger.id 
-         << ") added to queue." << endl;
+    LOG_INFO("Passenger " << passenger.name << " (ID: " << passenger.id 
+             << ") added to queue.");
+}
+
+// Enqueue Batch - Time: O(batch), Space: O(batch)
+void Queue::enqueueBatch(const vector<Passenger>& passengers) {
+    for (size_t i = 0; i < passengers.size(); i++) {
+        QueueNode* newNode = new QueueNode(passengers[i]);
+        if (rear == nullptr) {
+            front = rear = newNode;
+        } else {
+            rear->next = newNode;
+            rear = newNode;
+        }
+    }
+    size += passengers.size();
 }
 
 // Dequeue - Time: O(1), Space: O(1)
 Passenger Queue::dequeue() {
     if (isEmpty()) {
-        cout << "Queue is empty!" << endl;
+        LOG_WARNING("Queue is empty!");
         return Passenger(-1, "", -1, -1);
     }
     
@@ -61,11 +76,11 @@ int Queue::getSize() const {
 // Display - Time: O(n), Space: O(1)
 void Queue::display() const {
     if (isEmpty()) {
-        cout << "Queue is empty!" << endl;
+        cout << "Queue is empty!\n";
         return;
     }
     
-    cout << "\n=== Passenger Queue (FIFO) ===" << endl;
+    cout << "\n=== Passenger Queue (FIFO) ===\n";
     QueueNode* current = front;
     int position = 1;
     
@@ -73,11 +88,11 @@ void Queue::display() const {
         cout << position << ". Passenger ID: " << current->data.id 
              << " | Name: " << current->data.name
              << " | Route: Station " << current->data.sourceStation 
-             << " -> Station " << current->data.destinationStation << endl;
+             << " -> Station " << current->data.destinationStation << '\n';
         current = current->next;
         position++;
     }
-    cout << "Total passengers in queue: " << size << endl;
+    cout << "Total passengers in queue: " << size << '\n';
 }
 
 void Queue::clear() {
@@ -0,0 +1,106 @@
+#include "Reachability.h"
+
+ReachabilityIndex::ReachabilityIndex() : numComponents(0), hasClosure(false), visitStamp(0) {
+    rowOffsets.push_back(0);
+}
+
+bool ReachabilityIndex::build(const Graph& graph, long long maxClosureBytes) {
+    numComponents = graph.stronglyConnectedComponents(component);
+    dag = graph.condensation(component, numComponents);
+    
+    componentSize.assign(numComponents, 0);
+    for (size_t v = 0; v < component.size(); v++) {
+        componentSize[component[v]]++;
+    }
+    
+    // Row c covers components [0, c)
+    rowOffsets.assign(numComponents + 1, 0);
+    for (int c = 0; c < numComponents; c++) {
+        rowOffsets[c + 1] = rowOffsets[c] + (c + 63) / 64;
+    }
+    closure.clear();
+    visitMark.assign(numComponents, 0);
+    visitStamp = 0;
+    hasClosure = rowOffsets[numComponents] * (long long)sizeof(unsigned long long) <= maxClosureBytes;
+    if (!hasClosure) return false;
+    
+    // Successors have lower IDs, so their rows are complete when row c is filled
+    closure.assign(rowOffsets[numComponents], 0);
+    for (int c = 0; c < numComponents; c++) {
+        unsigned long long* row = closure.data() + rowOffsets[c];
+        for (int e = dag.edgeBegin(c); e < dag.edgeEnd(c); e++) {
+            int d = dag.edgeTarget(e);
+            row[d >> 6] |= 1ULL << (d & 63);
+            const unsigned long long* successor = closure.data() + rowOffsets[d];
+            long long words = rowOffsets[d + 1] - rowOffsets[d];
+            for (long long w = 0; w < words; w++) {
+                row[w] |= successor[w];
+            }
+        }
+    }
+    return true;
+}
+
+// DFS from component 'from' that never enters components below 'to' - Time: O(DAG)
+bool ReachabilityIndex::searchDAG(int from, int to) const {
+    if (visitStamp == 2147483647) {
+        visitMark.assign(numComponents, 0);
+        visitStamp = 0;
+    }
+    visitStamp++;
+    stack.clear();
+    stack.push_back(from);
+    visitMark[from] = visitStamp;
+    
+    while (!stack.empty()) {
+        int c = stack.back();
+        stack.pop_back();
+        for (int e = dag.edgeBegin(c); e < dag.edgeEnd(c); e++) {
+            int d = dag.edgeTarget(e);
+            if (d == to) return true;
+            if (d > to && visitMark[d] != visitStamp) {
+                visitMark[d] = visitStamp;
+                stack.push_back(d);
+            }
+        }
+    }
+    return false;
+}
+
+// Can Reach - Time: O(1) with the closure, O(DAG) otherwise
+bool ReachabilityIndex::canReach(int from, int to) const {
+    if (from < 0 || to < 0 || from >= (int)component.size() || to >= (int)component.size()) return false;
+    int a = component[from];
+    int b = component[to];
+    if (a == b) return true;
+    if (b > a) return false;  // Routes only lead to lower IDs
+    if (hasClosure) return (closure[rowOffsets[a] + (b >> 6)] >> (b & 63)) & 1ULL;
+    return searchDAG(a, b);
+}
+
+bool ReachabilityIndex::mutuallyReachable(int a, int b) const {
+    if (a < 0 || b < 0 || a >= (int)component.size() || b >= (int)component.size()) return false;
+    return component[a] == component[b];
+}
+
+int ReachabilityIndex::componentOf(int station) const {
+    if (station < 0 || station >= (int)component.size()) return -1;
+    return component[station];
+}
+
+int ReachabilityIndex::getComponentSize(int id) const {
+    if (id < 0 || id >= numComponents) return 0;
+    return componentSize[id];
+}
+
+int ReachabilityIndex::getLargestComponent() const {
+    int best = -1;
+    for (int c = 0; c < numComponents; c++) {
+        if (best == -1 || componentSize[c] > componentSize[best]) best = c;
+    }
+    return best;
+}
+
+long long ReachabilityIndex::getMemoryUsage() const {
+    return (long long)sizeof(unsigned long long) * closure.capacity();
+}
@@ -49,11 +49,11 @@ int Stack::getSize() const {
 // Display - Time: O(n), Space: O(1)
 void Stack::display() const {
     if (isEmpty()) {
-        cout << "History stack is empty!" << endl;
+        cout << "History stack is empty!\n";
         return;
     }
     
-    cout << "\n=== Operation History (LIFO) ===" << endl;
+    cout << "\n=== Operation History (LIFO) ===\n";
     StackNode* current = top;
     int position = 1;
     
@@ -67,11 +67,11 @@ void Stack::display() const {
                  << " -> " << current->data.destId 
                  << " (weight: " << current->data.weight << ")";
         }
-        cout << endl;
+        cout << '\n';
         current = current->next;
         position++;
     }
-    cout << "Total operations: " << size << endl;
+    cout << "Total operations: " << size << '\n';
 }
 
 void Stack::clear() {
@@ -6,6 +6,9 @@
  * 
  * Compilation: g++ -std=c++11 -o test_suite TestSuite.cpp Graph.cpp Queue.cpp 
  *              Stack.cpp HashTable.cpp BST.cpp Heap.cpp SearchSort.cpp Analytics.cpp
+ *              CSRGraph.cpp Heuristic.cpp ContractionHierarchy.cpp ThreadPool.cpp
+ *              TimeProfile.cpp Timetable.cpp Reachability.cpp GraphFile.cpp
+ *              BulkLoader.cpp Logger.cpp VehicleRegistry.cpp VehicleIndex.cpp -pthread
  */
 
 #include <iostream>
@@ -13,6 +16,12 @@
 #include <chrono>
 #include <iomanip>
 #include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 #include "Graph.h"
 #include "Queue.h"
 #include "Stack.h"
@@ -21,6 +30,15 @@
 #include "Heap.h"
 #include "SearchSort.h"
 #include "Analytics.h"
+#include "Heuristic.h"
+#include "ContractionHierarchy.h"
+#include "ThreadPool.h"
+#include "Timetable.h"
+#include "Reachability.h"
+#include "GraphFile.h"
+#include "BulkLoader.h"
+#include "Logger.h"
+#include "VehicleRegistry.h"
 
 using namespace std;
 using namespace std::chrono;
@@ -49,6 +67,126 @@ void recordTest(const string& name, bool passed, double time, const string& msg
     cout << " (" << fixed << setprecision(3) << time << " ms)" << endl;
 }
 
+// Stream buffer that discards everything (keeps bulk benchmark setup quiet)
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) { return c; }
+};
+
+NullBuffer nullBuffer;
+streambuf* savedCoutBuffer = nullptr;
+
+void silenceOutput() { savedCoutBuffer = cout.rdbuf(&nullBuffer); }
+void restoreOutput() { cout.rdbuf(savedCoutBuffer); }
+
+// Builds a side x side grid network with two-way routes and pseudo-random weights
+// in [minWeight, maxWeight]; station i sits at planar coordinates (column, row)
+void buildGridGraph(Graph& graph, int side, int minWeight = 1, int maxWeight = 20) {
+    unsigned int seed = 12345;
+    for (int i = 0; i < side * side; i++) {
+        graph.addStation(i, "Grid " + to_string(i), i % side, i / side);
+    }
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) {
+                seed = seed * 1103515245 + 12345;
+                int w = minWeight + (seed >> 16) % (maxWeight - minWeight + 1);
+                graph.addRoute(u, u + 1, w);
+                graph.addRoute(u + 1, u, w);
+            }
+            if (r + 1 < side) {
+                seed = seed * 1103515245 + 12345;
+                int w = minWeight + (seed >> 16) % (maxWeight - minWeight + 1);
+                graph.addRoute(u, u + side, w);
+                graph.addRoute(u + side, u, w);
+            }
+        }
+    }
+}
+
+// Sums the route weights along a path, -1 if some hop is not a route
+int pathCost(const Graph& graph, const vector<int>& path) {
+    int cost = 0;
+    for (size_t i = 0; i + 1 < path.size(); i++) {
+        int w = graph.getRouteWeight(path[i], path[i + 1]);
+        if (w < 0) return -1;
+        cost += w;
+    }
+    return cost;
+}
+
+// Recursive reference traversals over a CSR snapshot (small graphs only)
+void recursiveDFS(const CSRGraph& csr, int v, vector<bool>& visited, vector<int>& order) {
+    visited[v] = true;
+    order.push_back(v);
+    for (int e = csr.edgeBegin(v); e < csr.edgeEnd(v); e++) {
+        if (!visited[csr.edgeTarget(e)]) recursiveDFS(csr, csr.edgeTarget(e), visited, order);
+    }
+}
+
+bool recursiveCycle(const CSRGraph& csr, int v, vector<int>& state) {
+    state[v] = 1;  // On the stack
+    for (int e = csr.edgeBegin(v); e < csr.edgeEnd(v); e++) {
+        int w = csr.edgeTarget(e);
+        if (state[w] == 1 || (state[w] == 0 && recursiveCycle(csr, w, state))) return true;
+    }
+    state[v] = 2;
+    return false;
+}
+
+// Hop counts from src by a plain FIFO BFS over a CSR snapshot (-1 if unreached)
+vector<int> referenceLevels(const CSRGraph& csr, int src) {
+    vector<int> level(csr.getNumVertices(), -1);
+    vector<int> fifo(1, src);
+    level[src] = 0;
+    for (size_t head = 0; head < fifo.size(); head++) {
+        int u = fifo[head];
+        for (int e = csr.edgeBegin(u); e < csr.edgeEnd(u); e++) {
+            int v = csr.edgeTarget(e);
+            if (level[v] == -1) {
+                level[v] = level[u] + 1;
+                fifo.push_back(v);
+            }
+        }
+    }
+    return level;
+}
+
+// True if order lists exactly the stations with level >= 0, grouped by nondecreasing level
+bool levelOrderMatches(const vector<int>& order, const vector<int>& level) {
+    int reached = 0;
+    for (size_t i = 0; i < level.size(); i++) {
+        if (level[i] >= 0) reached++;
+    }
+    if ((int)order.size() != reached) return false;
+    vector<bool> seen(level.size(), false);
+    for (size_t i = 0; i < order.size(); i++) {
+        if (level[order[i]] < 0 || seen[order[i]]) return false;
+        if (i > 0 && level[order[i]] < level[order[i - 1]]) return false;
+        seen[order[i]] = true;
+    }
+    return true;
+}
+
+// Total weight of a spanning forest, or -1 if an edge is not a route (smaller -> larger ID
+// with that weight) or the edges close a cycle
+long long forestWeight(const Graph& graph, const vector<pair<pair<int, int>, int>>& forest) {
+    vector<int> root(graph.getNumVertices());
+    for (size_t i = 0; i < root.size(); i++) root[i] = i;
+    long long total = 0;
+    for (size_t i = 0; i < forest.size(); i++) {
+        int a = forest[i].first.first, b = forest[i].first.second;
+        if (a >= b || graph.getRouteWeight(a, b) != forest[i].second) return -1;
+        while (root[a] != a) a = root[a];
+        while (root[b] != b) b = root[b];
+        if (a == b) return -1;
+        root[a] = b;
+        total += forest[i].second;
+    }
+    return total;
+}
+
 // ==================== GRAPH TESTS ====================
 
 void testGraphOperations() {
@@ -77,7 +215,7 @@ void testGraphOperations() {
     graph.addRoute(3, 4, 12);
     end = high_resolution_clock::now();
     time = duration<double, milli>(end - start).count();
-    recordTest("Add Routes", true, time);
+    recordTest("Add Routes", graph.getRouteWeight(2, 3) == 8 && graph.getRouteWeight(3, 2) == -1, time);
     
     // Test 3: BFS
     start = high_resolution_clock::now();
@@ -103,6 +241,29 @@ void testGraphOperations() {
     recordTest("Shortest Path (Dijkstra)", !path.empty(), time,
                "Path length: " + to_string(path.size()));
     
+    // Test 5a: Invalid stations return no path and reset the previous query's stats
+    SearchStats invalidStats;
+    silenceOutput();
+    graph.shortestPath(0, 4, &invalidStats);
+    bool invalidRejected = invalidStats.settledNodes > 0 && graph.shortestPath(-1, 4, &invalidStats).empty() &&
+                           invalidStats.distance == INT_MAX && invalidStats.settledNodes == 0 &&
+                           graph.shortestPath(4, -1, &invalidStats).empty() &&
+                           graph.shortestPath(4, 10, nullptr).empty();
+    restoreOutput();
+    recordTest("Shortest Path Invalid Stations", invalidRejected, 0.0);
+    
+    // Test 5b: Heap Dijkstra matches the linear-scan reference
+    bool samePaths = true;
+    for (int from = 0; from < 5; from++) {
+        for (int to = 0; to < 5; to++) {
+            silenceOutput();
+            bool same = graph.shortestPath(from, to) == graph.shortestPathLinearScan(from, to);
+            restoreOutput();
+            if (!same) samePaths = false;
+        }
+    }
+    recordTest("Heap Dijkstra Matches Linear Scan", samePaths, 0.0);
+    
     // Test 6: MST
     start = high_resolution_clock::now();
     vector<pair<pair<int, int>, int>> mst = graph.minimumSpanningTree();
@@ -118,6 +279,1160 @@ void testGraphOperations() {
     time = duration<double, milli>(end - start).count();
     recordTest("Cycle Detection", true, time, 
                hasCycle ? "Cycle found" : "No cycle");
+    
+    // Test 8: CSR snapshot gives the same results as the Graph
+    start = high_resolution_clock::now();
+    CSRGraph csr = graph.freeze();
+    end = high_resolution_clock::now();
+    time = duration<double, milli>(end - start).count();
+    silenceOutput();
+    vector<int> graphPath = graph.shortestPath(0, 4);
+    restoreOutput();
+    bool csrMatches = csr.BFS(0) == bfsResult && csr.DFS(0) == dfsResult &&
+                      csr.shortestPath(0, 4) == graphPath &&
+                      csr.minimumSpanningTree() == mst && csr.detectCycle() == hasCycle;
+    recordTest("CSR Snapshot (freeze)", csrMatches, time,
+               "Edges packed: " + to_string(csr.getNumEdges()));
+    
+    // Test 9: Large station ID no longer allocates a dense V x V matrix
+    Graph sparseGraph;
+    start = high_resolution_clock::now();
+    silenceOutput();
+    sparseGraph.addStation(200000, "Far Terminal");
+    sparseGraph.addStation(1, "Near Terminal");
+    sparseGraph.addRoute(1, 200000, 42);
+    restoreOutput();
+    end = high_resolution_clock::now();
+    time = duration<double, milli>(end - start).count();
+    recordTest("Sparse Station IDs", sparseGraph.getRouteWeight(1, 200000) == 42, time);
+    
+    // Test 10: Station index stays in sync through deletes
+    Graph indexGraph(5);
+    silenceOutput();
+    indexGraph.addStation(0, "A");
+    indexGraph.addStation(1, "B");
+    indexGraph.addStation(2, "C");
+    indexGraph.addStation(1, "Duplicate");
+    indexGraph.deleteStation(0);
+    indexGraph.addStation(3, "D");
+    restoreOutput();
+    Station* c = indexGraph.getStation(2);
+    Station* d = indexGraph.getStation(3);
+    recordTest("Station Index Lookup",
+               !indexGraph.stationExists(0) && indexGraph.getStation(1)->name == "B" &&
+               c != nullptr && c->name == "C" && d != nullptr && d->name == "D" &&
+               indexGraph.getAllStations().size() == 3, 0.0);
+    
+    // Test 10b: Station IDs above the cap are refused instead of sizing every
+    // per-ID array to them
+    silenceOutput();
+    indexGraph.addStation(2000000000, "Far Away");
+    indexGraph.addStation(Graph::MAX_STATION_ID + 1, "Just Past The Cap");
+    vector<Station> farBatch;
+    farBatch.push_back(Station(2000000000, "Far Batch"));
+    farBatch.push_back(Station(5, "E"));
+    int farAdded = indexGraph.addStations(farBatch);
+    Graph clamped(-3);
+    restoreOutput();
+    recordTest("Station ID Cap", farAdded == 1 && indexGraph.getNumVertices() == 6 &&
+               !indexGraph.stationExists(2000000000) && indexGraph.stationExists(5) &&
+               clamped.getNumVertices() == 0, 0.0);
+    
+    // Test 11: Routes survive adjacency list growth (pooled edge nodes)
+    Graph growGraph(2);
+    silenceOutput();
+    growGraph.addStation(0, "A");
+    growGraph.addStation(1, "B");
+    growGraph.addRoute(0, 1, 5);
+    growGraph.addRoute(1, 0, 6);
+    for (int i = 2; i < 2000; i++) {
+        growGraph.addStation(i, "S" + to_string(i));
+        growGraph.addRoute(0, i, i);
+    }
+    growGraph.deleteRoute(0, 1999);
+    growGraph.addRoute(0, 2000, 1);  // Invalid, station 2000 does not exist
+    growGraph.addStation(2000, "Tail");
+    growGraph.addRoute(0, 2000, 7);
+    restoreOutput();
+    // Test 12: A* agrees with Dijkstra (Euclidean and great-circle heuristics)
+    Graph geoGraph(5);
+    silenceOutput();
+    geoGraph.addStation(0, "Lahore", 31.5204, 74.3587);
+    geoGraph.addStation(1, "Faisalabad", 31.4504, 73.1350);
+    geoGraph.addStation(2, "Multan", 30.1575, 71.5249);
+    geoGraph.addStation(3, "Islamabad", 33.6844, 73.0479);
+    geoGraph.addStation(4, "Sialkot", 32.4945, 74.5229);
+    geoGraph.addRoute(0, 1, 150);
+    geoGraph.addRoute(1, 2, 200);
+    geoGraph.addRoute(0, 4, 130);
+    geoGraph.addRoute(4, 3, 240);
+    geoGraph.addRoute(0, 3, 400);
+    geoGraph.addRoute(3, 2, 500);
+    geoGraph.addRoute(0, 2, 420);
+    SearchStats dijkstraStats;
+    vector<int> dijkstraPath = geoGraph.shortestPath(0, 2, &dijkstraStats);
+    restoreOutput();
+    CoordinateHeuristic greatCircle(geoGraph, CoordinateHeuristic::GREAT_CIRCLE);
+    SearchStats aStarStats;
+    vector<int> aStarPath = geoGraph.aStar(0, 2, greatCircle, &aStarStats);
+    bool geoMatch = aStarStats.distance == dijkstraStats.distance && aStarPath == dijkstraPath;
+    
+    Graph gridGraph(400);
+    silenceOutput();
+    buildGridGraph(gridGraph, 20);
+    restoreOutput();
+    CoordinateHeuristic euclidean(gridGraph);
+    for (int q = 0; q < 20; q++) {
+        int src = (q * 37) % 400;
+        int dest = (q * 151 + 7) % 400;
+        silenceOutput();
+        gridGraph.shortestPath(src, dest, &dijkstraStats);
+        restoreOutput();
+        gridGraph.aStar(src, dest, euclidean, &aStarStats);
+        if (aStarStats.distance != dijkstraStats.distance) geoMatch = false;
+    }
+    recordTest("A* Search (Coordinate Heuristics)", geoMatch, aStarStats.elapsedMs);
+    
+    // Test 13: Bidirectional Dijkstra agrees with Dijkstra; reverse lists follow edits
+    bool biMatch = true;
+    SearchStats biStats;
+    for (int q = 0; q < 40; q++) {
+        int src = (q * 53) % 400;
+        int dest = (q * 211 + 3) % 400;
+        silenceOutput();
+        gridGraph.shortestPath(src, dest, &dijkstraStats);
+        restoreOutput();
+        vector<int> biPath = gridGraph.shortestPathBidirectional(src, dest, &biStats);
+        if (biPath.empty() || biStats.distance != dijkstraStats.distance || pathCost(gridGraph, biPath) != biStats.distance ||
+            biPath.front() != src || biPath.back() != dest) {
+            biMatch = false;
+        }
+    }
+    silenceOutput();
+    gridGraph.addRoute(0, 1, 1000);   // Weight update must reach the reverse list too
+    gridGraph.addRoute(1, 0, 1000);
+    gridGraph.shortestPath(0, 1, &dijkstraStats);
+    restoreOutput();
+    gridGraph.shortestPathBidirectional(0, 1, &biStats);
+    if (biStats.distance != dijkstraStats.distance) biMatch = false;
+    
+    Graph hubGraph(5);
+    silenceOutput();
+    for (int i = 0; i < 5; i++) hubGraph.addStation(i, "Hub " + to_string(i));
+    hubGraph.addRoute(0, 2, 4);
+    hubGraph.addRoute(1, 2, 3);
+    hubGraph.addRoute(2, 3, 2);
+    hubGraph.addRoute(2, 4, 6);
+    hubGraph.addRoute(3, 4, 1);
+    hubGraph.addRoute(2, 2, 9);
+    hubGraph.deleteStation(2);
+    restoreOutput();
+    vector<int> cutPath = hubGraph.shortestPathBidirectional(0, 4, &biStats);
+    biMatch = biMatch && cutPath.empty() && biStats.distance == INT_MAX && hubGraph.getNumRoutes() == 1 &&
+              hubGraph.getRouteWeight(0, 2) == -1 && hubGraph.getRouteWeight(3, 4) == 1 &&
+              hubGraph.shortestPathBidirectional(3, 3).size() == 1;
+    recordTest("Bidirectional Dijkstra", biMatch, biStats.elapsedMs);
+    
+    // Test 14: Landmark (ALT) A* agrees with Dijkstra; tables survive a save/load round trip
+    bool altMatch = true;
+    LandmarkHeuristic farthest(gridGraph, 4, LandmarkHeuristic::FARTHEST);
+    LandmarkHeuristic avoid(gridGraph, 4, LandmarkHeuristic::AVOID);
+    LandmarkHeuristic reloaded;
+    altMatch = altMatch && farthest.getNumLandmarks() == 4 && avoid.getNumLandmarks() == 4 &&
+               avoid.save("test_landmarks.bin") && reloaded.load("test_landmarks.bin") &&
+               reloaded.matches(gridGraph) && reloaded.getLandmarks() == avoid.getLandmarks();
+    for (int q = 0; q < 40; q++) {
+        int src = (q * 53) % 400;
+        int dest = (q * 211 + 3) % 400;
+        silenceOutput();
+        gridGraph.shortestPath(src, dest, &dijkstraStats);
+        restoreOutput();
+        gridGraph.aStar(src, dest, farthest, &aStarStats);
+        if (aStarStats.distance != dijkstraStats.distance) altMatch = false;
+        gridGraph.aStar(src, dest, reloaded, &aStarStats);
+        if (aStarStats.distance != dijkstraStats.distance || reloaded.estimate(src, dest) != avoid.estimate(src, dest)) {
+            altMatch = false;
+        }
+    }
+    silenceOutput();
+    gridGraph.addRoute(5, 6, 1);  // Tables are now stale
+    restoreOutput();
+    LandmarkHeuristic corrupt;
+    altMatch = altMatch && !reloaded.matches(gridGraph) && !corrupt.load("nonexistent_landmarks.bin");
+    remove("test_landmarks.bin");
+    recordTest("Landmark A* (ALT)", altMatch, aStarStats.elapsedMs);
+    
+    // Test 15: Distance matrix matches pairwise Dijkstra, serial and on a thread pool
+    vector<int> depots, stops;
+    for (int i = 0; i < 6; i++) depots.push_back((i * 67) % 400);
+    for (int i = 0; i < 25; i++) stops.push_back((i * 151 + 11) % 400);
+    depots.push_back(-1);      // Invalid rows and columns stay INT_MAX
+    stops.push_back(5000);
+    start = high_resolution_clock::now();
+    vector<int> serialMatrix = gridGraph.distanceMatrix(depots, stops, 1);
+    vector<int> parallelMatrix = gridGraph.distanceMatrix(depots, stops, 3);
+    end = high_resolution_clock::now();
+    bool matrixMatch = serialMatrix.size() == depots.size() * stops.size() && serialMatrix == parallelMatrix;
+    for (size_t i = 0; i + 1 < depots.size() && matrixMatch; i++) {
+        for (size_t j = 0; j + 1 < stops.size(); j++) {
+            silenceOutput();
+            gridGraph.shortestPath(depots[i], stops[j], &dijkstraStats);
+            restoreOutput();
+            if (serialMatrix[i * stops.size() + j] != dijkstraStats.distance) matrixMatch = false;
+        }
+        if (serialMatrix[i * stops.size() + stops.size() - 1] != INT_MAX) matrixMatch = false;
+    }
+    for (size_t j = 0; j < stops.size(); j++) {
+        if (serialMatrix[(depots.size() - 1) * stops.size() + j] != INT_MAX) matrixMatch = false;
+    }
+    recordTest("Distance Matrix", matrixMatch, duration<double, milli>(end - start).count());
+    
+    // Test 16: Time-dependent routing follows rush-hour profiles
+    Graph rushGraph(3);
+    silenceOutput();
+    rushGraph.addStation(0, "Suburb");
+    rushGraph.addStation(1, "Ring Road");
+    rushGraph.addStation(2, "Centre");
+    rushGraph.addRoute(0, 2, 10);
+    rushGraph.addRoute(0, 1, 5);
+    rushGraph.addRoute(1, 2, 10);
+    // 10 minutes off-peak, 30 at 08:00, back to 10 by 10:00 (minutes since midnight)
+    int rush = rushGraph.addTravelTimeProfile({0, 420, 480, 600}, {10, 10, 30, 10});
+    int rushAgain = rushGraph.addTravelTimeProfile({0, 420, 480, 600}, {10, 10, 30, 10});
+    int notFifo = rushGraph.addTravelTimeProfile({0, 10}, {100, 50});
+    int unordered = rushGraph.addTravelTimeProfile({30, 30}, {5, 5});
+    bool attached = rushGraph.setRouteProfile(0, 2, rush) && !rushGraph.setRouteProfile(2, 0, rush);
+    restoreOutput();
+    SearchStats offPeak, peak, shoulder;
+    vector<int> offPeakPath = rushGraph.shortestPathAt(0, 2, 180, &offPeak);
+    vector<int> peakPath = rushGraph.shortestPathAt(0, 2, 480, &peak);
+    rushGraph.shortestPathAt(0, 2, 1440 + 470, &shoulder);  // Profiles repeat every day
+    const TravelTimeProfiles& store = rushGraph.getProfiles();
+    bool timeMatch = rush == 0 && rushAgain == rush && notFifo == -1 && unordered == -1 && attached &&
+                     store.evaluate(rush, 450) == 20 && store.evaluate(rush, -990) == 20 &&
+                     store.evaluate(rush, 1000) == 10 && rushGraph.getRouteTravelTime(0, 2, 540) == 20 &&
+                     offPeak.distance == 10 && offPeakPath.size() == 2 &&
+                     peak.distance == 15 && peakPath.size() == 3 && shoulder.distance == 15;
+    for (int q = 0; q < 10; q++) {
+        int src = (q * 53) % 400;
+        int dest = (q * 211 + 3) % 400;
+        silenceOutput();
+        gridGraph.shortestPath(src, dest, &dijkstraStats);
+        restoreOutput();
+        gridGraph.shortestPathAt(src, dest, q * 100, &peak);
+        if (peak.distance != dijkstraStats.distance) timeMatch = false;  // No profiles: same as static
+    }
+    recordTest("Time-Dependent Routing", timeMatch, offPeak.elapsedMs);
+    
+    // Test 17: k shortest loopless paths match brute-force enumeration
+    Graph smallGrid(16);
+    silenceOutput();
+    buildGridGraph(smallGrid, 4);
+    smallGrid.addRoute(0, 5, 3);   // One-way diagonals
+    smallGrid.addRoute(10, 15, 2);
+    restoreOutput();
+    vector<int> allCosts;  // Cost of every simple 0 -> 15 path, by explicit DFS
+    vector<int> stackNodes(1, 0), stackNext(1, 0), stackCost(1, 0);
+    vector<bool> onPath(16, false);
+    onPath[0] = true;
+    while (!stackNodes.empty()) {
+        int u = stackNodes.back();
+        int next = stackNext.back()++;
+        if (u == 15 || next >= 16) {
+            if (u == 15 && next == 0) allCosts.push_back(stackCost.back());
+            onPath[u] = false;
+            stackNodes.pop_back();
+            stackNext.pop_back();
+            stackCost.pop_back();
+            continue;
+        }
+        int w = smallGrid.getRouteWeight(u, next);
+        if (w >= 0 && !onPath[next]) {
+            onPath[next] = true;
+            stackNodes.push_back(next);
+            stackNext.push_back(0);
+            stackCost.push_back(stackCost.back() + w);
+        }
+    }
+    SearchSort::quickSort(allCosts);
+    vector<int> kCosts;
+    start = high_resolution_clock::now();
+    vector<vector<int>> kPaths = smallGrid.kShortestPaths(0, 15, 25, &kCosts);
+    end = high_resolution_clock::now();
+    bool kMatch = kPaths.size() == 25 && kCosts.size() == 25;
+    for (size_t i = 0; i < kPaths.size() && kMatch; i++) {
+        vector<bool> seen(16, false);
+        for (size_t j = 0; j < kPaths[i].size(); j++) {
+            if (seen[kPaths[i][j]]) kMatch = false;  // Must be loopless
+            seen[kPaths[i][j]] = true;
+        }
+        for (size_t j = 0; j < i; j++) {
+            if (kPaths[j] == kPaths[i]) kMatch = false;  // Must be distinct
+        }
+        if (kCosts[i] != allCosts[i] || pathCost(smallGrid, kPaths[i]) != kCosts[i] ||
+            kPaths[i].front() != 0 || kPaths[i].back() != 15) kMatch = false;
+    }
+    kMatch = kMatch && smallGrid.kShortestPaths(0, 15, (int)allCosts.size() + 10).size() == allCosts.size() &&
+             smallGrid.kShortestPaths(3, 3, 5).size() == 1 && smallGrid.kShortestPaths(0, 99, 5).empty();
+    recordTest("K Shortest Paths (Yen)", kMatch, duration<double, milli>(end - start).count());
+    
+    // Test 18: Hub trees stay exact through weight changes, new routes and closures
+    Graph dynamicGrid(144);
+    silenceOutput();
+    buildGridGraph(dynamicGrid, 12);
+    restoreOutput();
+    vector<int> hubs, everyStation;
+    hubs.push_back(0);
+    hubs.push_back(77);
+    for (int i = 0; i < 144; i++) everyStation.push_back(i);
+    dynamicGrid.addHub(0);
+    dynamicGrid.addHub(77);
+    bool hubsMatch = dynamicGrid.getNumHubs() == 2 && dynamicGrid.hubDistance(5, 0) == -1;
+    unsigned int updateSeed = 99;
+    double repairTime = 0.0;
+    silenceOutput();
+    for (int step = 1; step <= 240 && hubsMatch; step++) {
+        updateSeed = updateSeed * 1103515245 + 12345;
+        int u = (updateSeed >> 8) % 144;
+        updateSeed = updateSeed * 1103515245 + 12345;
+        int v = (updateSeed >> 8) % 144;
+        updateSeed = updateSeed * 1103515245 + 12345;
+        int weight = 1 + (updateSeed >> 8) % 40;
+        if (u == v) continue;
+        start = high_resolution_clock::now();
+        if (step % 4 == 0) {
+            dynamicGrid.deleteRoute(u, v);                    // Usually absent: no-op
+            int w = (u + 1 < 144) ? u + 1 : u - 1;
+            dynamicGrid.deleteRoute(u, w);                    // Close a grid route
+        } else if (step % 4 == 1) {
+            dynamicGrid.addRoute(u, v, weight);               // New shortcut
+        } else {
+            int w = (u + 12 < 144) ? u + 12 : u - 12;
+            dynamicGrid.addRoute(u, w, weight);               // Re-weight (or reopen) a route
+        }
+        end = high_resolution_clock::now();
+        repairTime += duration<double, milli>(end - start).count();
+        
+        if (step % 10 == 0) {
+            vector<int> expected = dynamicGrid.distanceMatrix(hubs, everyStation, 1);
+            for (int h = 0; h < 2; h++) {
+                for (int t = 0; t < 144; t++) {
+                    int d = dynamicGrid.hubDistance(hubs[h], t);
+                    if (d != expected[h * 144 + t]) hubsMatch = false;
+                    vector<int> path = dynamicGrid.hubPath(hubs[h], t);
+                    if (d != INT_MAX && (path.empty() || path.front() != hubs[h] ||
+                                         path.back() != t || pathCost(dynamicGrid, path) != d)) hubsMatch = false;
+                }
+            }
+        }
+    }
+    dynamicGrid.deleteStation(77);
+    restoreOutput();
+    hubsMatch = hubsMatch && dynamicGrid.getNumHubs() == 1 && dynamicGrid.hubDistance(0, 77) == INT_MAX &&
+                dynamicGrid.hubDistance(0, 0) == 0 && dynamicGrid.hubPath(0, 77).empty();
+    recordTest("Dynamic Hub Trees", hubsMatch, repairTime / 240);
+    
+    // Test 19: Iterative DFS/cycle detection match the recursive order and survive long corridors
+    bool traversalMatch = true;
+    unsigned int dagSeed = 7;
+    for (int trial = 0; trial < 30 && traversalMatch; trial++) {
+        Graph randomGraph(40);
+        silenceOutput();
+        for (int i = 0; i < 40; i++) randomGraph.addStation(i, "D" + to_string(i));
+        for (int r = 0; r < 60; r++) {
+            dagSeed = dagSeed * 1103515245 + 12345;
+            int u = (dagSeed >> 8) % 40;
+            dagSeed = dagSeed * 1103515245 + 12345;
+            int v = (dagSeed >> 8) % 40;
+            // Mostly forward routes, so roughly half the trials stay acyclic
+            if (u != v && (u < v || trial % 2 == 0)) randomGraph.addRoute(u, v, 1);
+        }
+        restoreOutput();
+        CSRGraph snapshot = randomGraph.freeze();
+        vector<int> state(40, 0);
+        bool expectedCycle = false;
+        for (int i = 0; i < 40 && !expectedCycle; i++) {
+            if (state[i] == 0) expectedCycle = recursiveCycle(snapshot, i, state);
+        }
+        if (randomGraph.detectCycle() != expectedCycle) traversalMatch = false;
+        for (int src = 0; src < 40; src += 7) {
+            vector<bool> visited(40, false);
+            vector<int> order;
+            recursiveDFS(snapshot, src, visited, order);
+            if (randomGraph.DFS(src) != order) traversalMatch = false;
+        }
+    }
+    
+    int corridorLength = 200000;
+    Graph corridor(corridorLength);
+    silenceOutput();
+    for (int i = 0; i < corridorLength; i++) corridor.addStation(i, "C" + to_string(i));
+    for (int i = 0; i + 1 < corridorLength; i++) corridor.addRoute(i, i + 1, 1);
+    restoreOutput();
+    start = high_resolution_clock::now();
+    vector<int> corridorOrder = corridor.DFS(0);
+    bool corridorCycle = corridor.detectCycle();
+    end = high_resolution_clock::now();
+    silenceOutput();
+    corridor.addRoute(corridorLength - 1, 0, 1);
+    restoreOutput();
+    traversalMatch = traversalMatch && corridorOrder.size() == (size_t)corridorLength &&
+                     corridorOrder.back() == corridorLength - 1 && !corridorCycle &&
+                     corridor.detectCycle() && corridor.DFS(corridorLength / 2).size() == (size_t)corridorLength &&
+                     corridor.DFS(-1).empty();
+    recordTest("Iterative DFS (200k Corridor)", traversalMatch, duration<double, milli>(end - start).count());
+    
+    // Test 20: Direction-optimizing parallel BFS reaches the same stations at the same levels
+    bool bfsMatch = true;
+    int switchedLevels = 0;
+    CSRGraph gridSnapshot = gridGraph.freeze();
+    vector<int> expectedLevels = referenceLevels(gridSnapshot, 0);
+    vector<int> bfsLevels;
+    start = high_resolution_clock::now();
+    vector<int> levelOrder = gridGraph.parallelBFS(0, &bfsLevels, 3);
+    end = high_resolution_clock::now();
+    if (bfsLevels != expectedLevels || !levelOrderMatches(levelOrder, expectedLevels)) bfsMatch = false;
+    
+    // Dense one-way network with unreachable stations: forces bottom-up levels
+    Graph denseGraph(3000);
+    silenceOutput();
+    for (int i = 0; i < 3000; i++) denseGraph.addStation(i, "N" + to_string(i));
+    unsigned int bfsSeed = 31;
+    for (int r = 0; r < 60000; r++) {
+        bfsSeed = bfsSeed * 1103515245 + 12345;
+        int u = (bfsSeed >> 8) % 2900;   // Stations 2900+ have no outgoing routes...
+        bfsSeed = bfsSeed * 1103515245 + 12345;
+        int v = (bfsSeed >> 8) % 2990;   // ...and 2990+ no incoming ones
+        if (u != v) denseGraph.addRoute(u, v, 1);
+    }
+    restoreOutput();
+    CSRGraph denseSnapshot = denseGraph.freeze();
+    for (int src = 0; src < 3000 && bfsMatch; src += 599) {
+        expectedLevels = referenceLevels(denseSnapshot, src);
+        for (int threads = 1; threads <= 4; threads += 3) {
+            int bottomUp = 0;
+            levelOrder = denseGraph.parallelBFS(src, &bfsLevels, threads, &bottomUp);
+            switchedLevels += bottomUp;
+            if (bfsLevels != expectedLevels || !levelOrderMatches(levelOrder, expectedLevels)) bfsMatch = false;
+        }
+    }
+    bfsMatch = bfsMatch && switchedLevels > 0 && denseGraph.parallelBFS(2995).size() == 1 &&
+               denseGraph.parallelBFS(5000, &bfsLevels).empty() && bfsLevels.size() == 3000;
+    recordTest("Direction-Optimizing BFS", bfsMatch, duration<double, milli>(end - start).count(),
+               "Bottom-up levels: " + to_string(switchedLevels));
+    
+    // Test 21: Kruskal (radix sort), Prim and Boruvka build equally light spanning forests
+    vector<pair<pair<int, int>, int>> gridForest = gridGraph.minimumSpanningTree();
+    long long gridWeight = forestWeight(gridGraph, gridForest);
+    bool mstMatch = gridForest == gridSnapshot.minimumSpanningTree() && gridForest.size() == 399 &&
+                    forestWeight(gridGraph, gridGraph.minimumSpanningTreePrim()) == gridWeight &&
+                    forestWeight(gridGraph, gridGraph.minimumSpanningTreeBoruvka(3)) == gridWeight;
+    unsigned int mstSeed = 5;
+    for (int trial = 0; trial < 20 && mstMatch; trial++) {
+        // Few distinct (some negative) weights force ties; stations 90+ stay isolated
+        Graph forestGraph(100);
+        silenceOutput();
+        for (int i = 0; i < 100; i++) forestGraph.addStation(i, "F" + to_string(i));
+        for (int r = 0; r < 150 + trial * 20; r++) {
+            mstSeed = mstSeed * 1103515245 + 12345;
+            int u = (mstSeed >> 8) % 90;
+            mstSeed = mstSeed * 1103515245 + 12345;
+            int v = (mstSeed >> 8) % 90;
+            mstSeed = mstSeed * 1103515245 + 12345;
+            if (u != v) forestGraph.addRoute(u, v, (int)((mstSeed >> 8) % 7) - 2);
+        }
+        restoreOutput();
+        vector<pair<pair<int, int>, int>> kruskal = forestGraph.minimumSpanningTree();
+        vector<pair<pair<int, int>, int>> prim = forestGraph.minimumSpanningTreePrim();
+        vector<pair<pair<int, int>, int>> boruvka = forestGraph.minimumSpanningTreeBoruvka(trial % 4 + 1);
+        long long expected = forestWeight(forestGraph, kruskal);
+        for (size_t i = 1; i < kruskal.size(); i++) {
+            if (kruskal[i].second < kruskal[i - 1].second) mstMatch = false;
+        }
+        if (expected == -1 || prim.size() != kruskal.size() || boruvka.size() != kruskal.size() ||
+            forestWeight(forestGraph, prim) != expected || forestWeight(forestGraph, boruvka) != expected ||
+            kruskal != forestGraph.freeze().minimumSpanningTree()) mstMatch = false;
+    }
+    recordTest("MST Variants (Kruskal/Prim/Boruvka)", mstMatch, 0.0,
+               "Grid MST weight: " + to_string(gridWeight));
+    
+    recordTest("Edge Pool Growth", growGraph.getRouteWeight(0, 1) == 5 &&
+               growGraph.getRouteWeight(1, 0) == 6 && growGraph.getRouteWeight(0, 1999) == -1 &&
+               growGraph.getRouteWeight(0, 2000) == 7 && growGraph.getNumRoutes() == 2000, 0.0);
+}
+
+void testContractionHierarchy() {
+    cout << "\n=== Testing Contraction Hierarchies ===" << endl;
+    
+    // Directed network: grid plus one-way express links
+    Graph graph(400);
+    silenceOutput();
+    buildGridGraph(graph, 20);
+    for (int i = 0; i + 45 < 400; i += 13) {
+        graph.addRoute(i, i + 45, 9);
+    }
+    restoreOutput();
+    
+    ContractionHierarchy ch;
+    auto start = high_resolution_clock::now();
+    ch.build(graph);
+    auto end = high_resolution_clock::now();
+    double time = duration<double, milli>(end - start).count();
+    recordTest("CH Preprocessing", ch.getNumVertices() == 400, time,
+               "Shortcuts: " + to_string(ch.getNumShortcuts()));
+    
+    // Distances and unpacked paths against Dijkstra
+    CSRGraph csr = graph.freeze();
+    bool distancesMatch = true;
+    bool pathsValid = true;
+    for (int src = 0; src < 400; src += 7) {
+        for (int dest = 0; dest < 400; dest += 11) {
+            int expected, actual;
+            csr.shortestPath(src, dest, &expected);
+            vector<int> path = ch.shortestPath(src, dest, &actual);
+            if (actual != expected || ch.distance(src, dest) != expected) distancesMatch = false;
+            if (path.empty() || path.front() != src || path.back() != dest ||
+                pathCost(graph, path) != expected) pathsValid = false;
+        }
+    }
+    recordTest("CH Distances Match Dijkstra", distancesMatch, 0.0);
+    recordTest("CH Unpacked Paths", pathsValid, 0.0);
+    
+    // Serialization round trip
+    bool saved = ch.save("ch_test.bin");
+    ContractionHierarchy loaded;
+    bool restored = saved && loaded.load("ch_test.bin");
+    
+    // Corrupted length of the first array (after magic, version, V and shortcut count)
+    {
+        fstream patch("ch_test.bin", ios::in | ios::out | ios::binary);
+        int huge = 0x7FFFFFFF;
+        patch.seekp(16);
+        patch.write(reinterpret_cast<const char*>(&huge), sizeof(int));
+    }
+    ContractionHierarchy corrupted;
+    bool rejectsLength = !corrupted.load("ch_test.bin");
+    
+    // Corrupted structure with every size intact: a nonzero first offset, a
+    // repeated rank, and a shortcut whose middle is one of its own ends
+    // (unpacking it would never finish)
+    ch.save("ch_test.bin");
+    vector<char> bytes;
+    {
+        ifstream in("ch_test.bin", ios::binary);
+        char c;
+        while (in.get(c)) bytes.push_back(c);
+    }
+    // Start of each array's data: rank, upOffsets, upTargets, upWeights, upMiddle, ...
+    vector<long long> arrayAt;
+    long long position = 16;
+    for (int a = 0; a < 9 && position + 4 <= (long long)bytes.size(); a++) {
+        int size;
+        memcpy(&size, &bytes[position], sizeof(int));
+        arrayAt.push_back(position + 4);
+        position += 4 + 4LL * size;
+    }
+    auto loadsPatched = [&](long long at, int value) {
+        vector<char> patched(bytes);
+        memcpy(&patched[at], &value, sizeof(int));
+        ofstream out("ch_test.bin", ios::binary);
+        out.write(&patched[0], patched.size());
+        out.close();
+        ContractionHierarchy attempt;
+        return attempt.load("ch_test.bin");
+    };
+    bool rejectsStructure = arrayAt.size() == 9 && loadsPatched(arrayAt[1], 0);
+    if (rejectsStructure) {
+        int firstRank;
+        memcpy(&firstRank, &bytes[arrayAt[0]], sizeof(int));
+        rejectsStructure = !loadsPatched(arrayAt[1], -1) && !loadsPatched(arrayAt[0] + 4, firstRank);
+        int shortcut = -1;
+        int upCount = (arrayAt[3] - arrayAt[2] - 4) / 4;
+        for (int e = 0; e < upCount && shortcut < 0; e++) {
+            int middle;
+            memcpy(&middle, &bytes[arrayAt[4] + 4LL * e], sizeof(int));
+            if (middle != -1) shortcut = e;
+        }
+        int target = 0;
+        if (shortcut >= 0) memcpy(&target, &bytes[arrayAt[2] + 4LL * shortcut], sizeof(int));
+        rejectsStructure = rejectsStructure && shortcut >= 0 &&
+                           !loadsPatched(arrayAt[4] + 4LL * shortcut, target);
+    }
+    remove("ch_test.bin");
+    bool sameAfterLoad = restored;
+    for (int q = 0; q < 50 && sameAfterLoad; q++) {
+        int src = (q * 31) % 400, dest = (q * 97 + 3) % 400;
+        if (loaded.distance(src, dest) != ch.distance(src, dest)) sameAfterLoad = false;
+    }
+    recordTest("CH Save/Load", sameAfterLoad, 0.0);
+    recordTest("CH Rejects Bad File", rejectsLength && rejectsStructure && !loaded.load("missing_ch_file.bin"), 0.0);
+}
+
+// ==================== TIMETABLE TESTS ====================
+
+// Reference earliest arrival by Connection Scan (no transfers) - O(C^2) sort, test sizes only
+vector<int> connectionScan(int stops, const vector<vector<int>>& connections, int src, int departureTime) {
+    // connections[i] = {depStop, arrStop, depTime, arrTime, trip}
+    vector<vector<int>> sorted = connections;
+    for (size_t i = 1; i < sorted.size(); i++) {
+        vector<int> key = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && sorted[j][2] > key[2]) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = key;
+    }
+    vector<int> arrival(stops, INT_MAX);
+    vector<bool> onTrip(connections.size(), false);
+    arrival[src] = departureTime;
+    for (size_t i = 0; i < sorted.size(); i++) {
+        const vector<int>& c = sorted[i];
+        if (onTrip[c[4]] || arrival[c[0]] <= c[2]) {
+            onTrip[c[4]] = true;
+            if (c[3] < arrival[c[1]]) arrival[c[1]] = c[3];
+        }
+    }
+    return arrival;
+}
+
+void testTimetable() {
+    cout << "\n=== Testing Timetable (RAPTOR) ===" << endl;
+    
+    Graph network(6);
+    silenceOutput();
+    for (int i = 0; i < 6; i++) network.addStation(i, "Stop " + to_string(i));
+    restoreOutput();
+    
+    // Line A 0-1-2 (two regular trips and an express that overtakes the first),
+    // line B 2-3, line C 4-3, and a 5 minute walk from 1 to 4
+    Timetable timetable(network);
+    silenceOutput();
+    int lineA = timetable.addRoute({0, 1, 2});
+    int lineB = timetable.addRoute({2, 3});
+    int lineC = timetable.addRoute({4, 3});
+    bool built = lineA == 0 && lineB == 1 && lineC == 2 &&
+                 timetable.addTrip(lineA, {100, 110, 120}, {100, 110, 120}) &&
+                 timetable.addTrip(lineA, {200, 210, 220}, {200, 210, 220}) &&
+                 timetable.addTrip(lineA, {105, 108, 112}, {105, 108, 112}) &&
+                 timetable.addTrip(lineB, {125, 145}, {125, 145}) &&
+                 timetable.addTrip(lineB, {225, 245}, {225, 245}) &&
+                 timetable.addTrip(lineC, {118, 140}, {118, 140}) &&
+                 timetable.addTransfer(1, 4, 5) &&
+                 timetable.addRoute({0, 9}) == -1 &&
+                 !timetable.addTrip(lineB, {130, 120}, {130, 120}) &&
+                 !timetable.addTransfer(1, 1, 3);
+    restoreOutput();
+    
+    auto start = high_resolution_clock::now();
+    int viaWalk = timetable.earliestArrival(0, 3, 90);
+    auto end = high_resolution_clock::now();
+    bool correct = built && viaWalk == 140 && timetable.getLastRounds() >= 2 &&
+                   timetable.earliestArrival(0, 2, 90) == 112 &&      // Express trip
+                   timetable.earliestArrival(0, 3, 90, 1) == INT_MAX &&  // Needs a second trip
+                   timetable.earliestArrival(0, 3, 150) == 245 &&
+                   timetable.earliestArrival(0, 3, 300) == INT_MAX &&   // Service has ended
+                   timetable.earliestArrival(5, 5, 77) == 77 &&
+                   timetable.getNumRoutes() == 4;                        // Line A split in two
+    vector<int> all = timetable.earliestArrivalAll(0, 90);
+    correct = correct && all[1] == 108 && all[4] == 113 && all[3] == 140 && all[5] == INT_MAX;
+    recordTest("RAPTOR Earliest Arrival", correct, duration<double, milli>(end - start).count());
+    
+    // Random timetable against a Connection Scan reference
+    int stops = 30;
+    Graph randomNetwork(stops);
+    silenceOutput();
+    for (int i = 0; i < stops; i++) randomNetwork.addStation(i, "R" + to_string(i));
+    restoreOutput();
+    Timetable randomTimetable(randomNetwork);
+    vector<vector<int>> connections;
+    unsigned int seed = 2024;
+    int tripId = 0;
+    for (int r = 0; r < 12; r++) {
+        vector<int> routeStops;
+        vector<bool> used(stops, false);
+        while (routeStops.size() < 6) {
+            seed = seed * 1103515245 + 12345;
+            int stop = (seed >> 8) % stops;
+            if (!used[stop]) {
+                used[stop] = true;
+                routeStops.push_back(stop);
+            }
+        }
+        int route = randomTimetable.addRoute(routeStops);
+        for (int t = 0; t < 8; t++) {
+            seed = seed * 1103515245 + 12345;
+            int time = (seed >> 8) % 600;
+            vector<int> arr, dep;
+            for (int i = 0; i < 6; i++) {
+                seed = seed * 1103515245 + 12345;
+                int dwell = (seed >> 8) % 3;
+                arr.push_back(time);
+                dep.push_back(time + dwell);
+                if (i + 1 < 6) {
+                    seed = seed * 1103515245 + 12345;
+                    int travel = 5 + (seed >> 8) % 40;
+                    connections.push_back({routeStops[i], routeStops[i + 1], time + dwell, time + dwell + travel, tripId});
+                    time += dwell + travel;
+                }
+            }
+            randomTimetable.addTrip(route, arr, dep);
+            tripId++;
+        }
+    }
+    bool matchesReference = true;
+    for (int src = 0; src < stops; src += 3) {
+        for (int departure = 0; departure < 600; departure += 150) {
+            vector<int> expected = connectionScan(stops, connections, src, departure);
+            vector<int> actual = randomTimetable.earliestArrivalAll(src, departure, 50);
+            if (actual != expected) matchesReference = false;
+            for (int dest = 0; dest < stops; dest += 7) {
+                if (randomTimetable.earliestArrival(src, dest, departure, 50) != expected[dest]) {
+                    matchesReference = false;
+                }
+            }
+        }
+    }
+    recordTest("RAPTOR Matches Connection Scan", matchesReference, 0.0);
+}
+
+// ==================== REACHABILITY TESTS ====================
+
+void testReachability() {
+    cout << "\n=== Testing Strongly Connected Components ===" << endl;
+    
+    // Ring 0 -> 1 -> 2 -> 0 feeding a two-way pair 3 <-> 4; 5 is isolated
+    Graph network(6);
+    silenceOutput();
+    for (int i = 0; i < 6; i++) network.addStation(i, "S" + to_string(i));
+    network.addRoute(0, 1, 4);
+    network.addRoute(1, 2, 4);
+    network.addRoute(2, 0, 4);
+    network.addRoute(2, 3, 7);
+    network.addRoute(1, 4, 2);
+    network.addRoute(3, 4, 1);
+    network.addRoute(4, 3, 1);
+    restoreOutput();
+    
+    vector<int> component;
+    auto start = high_resolution_clock::now();
+    int count = network.stronglyConnectedComponents(component);
+    auto end = high_resolution_clock::now();
+    CSRGraph dag = network.condensation(component, count);
+    bool basic = count == 3 && component[0] == component[1] && component[1] == component[2] &&
+                 component[3] == component[4] && component[3] != component[0] &&
+                 component[5] != component[0] && component[5] != component[3] &&
+                 dag.getNumEdges() == 1 && dag.degree(component[0]) == 1 &&
+                 dag.edgeTarget(dag.edgeBegin(component[0])) == component[3] &&
+                 dag.edgeWeight(dag.edgeBegin(component[0])) == 2;  // Lightest of 2->3 and 1->4
+    recordTest("SCC and Condensation", basic, duration<double, milli>(end - start).count());
+    
+    // Closing 2 -> 0 splits the ring: 0 can still reach 4, but nothing gets back to 0
+    ReachabilityIndex index;
+    bool exact = index.build(network);
+    bool before = exact && index.canReach(3, 4) && index.canReach(2, 1) && index.canReach(0, 3) &&
+                  !index.canReach(3, 0) && !index.canReach(5, 0) && !index.canReach(0, 5) &&
+                  index.getComponentSize(index.getLargestComponent()) == 3;
+    silenceOutput();
+    network.deleteRoute(2, 0);
+    restoreOutput();
+    index.build(network);
+    bool after = index.getNumComponents() == 5 && index.canReach(0, 4) && !index.canReach(1, 0) &&
+                 !index.mutuallyReachable(0, 2) && index.mutuallyReachable(3, 4) &&
+                 !index.canReach(0, 99) && index.componentOf(-1) == -1;
+    recordTest("Reachability After Closure", before && after, 0.0);
+    
+    // Random one-way networks vs BFS from every station, closure and DFS fallback
+    bool randomMatch = true;
+    unsigned int seed = 17;
+    for (int trial = 0; trial < 25 && randomMatch; trial++) {
+        int n = 80;
+        Graph randomGraph(n);
+        silenceOutput();
+        for (int i = 0; i < n; i++) randomGraph.addStation(i, "R" + to_string(i));
+        for (int r = 0; r < 40 + trial * 8; r++) {
+            seed = seed * 1103515245 + 12345;
+            int u = (seed >> 8) % n;
+            seed = seed * 1103515245 + 12345;
+            int v = (seed >> 8) % n;
+            if (u != v) randomGraph.addRoute(u, v, 1 + (seed >> 20) % 9);
+        }
+        restoreOutput();
+        
+        ReachabilityIndex closureIndex, searchIndex;
+        closureIndex.build(randomGraph);
+        if (searchIndex.build(randomGraph, 0) || !closureIndex.isConstantTime()) randomMatch = false;
+        const CSRGraph& condensed = closureIndex.getCondensation();
+        if (condensed.detectCycle()) randomMatch = false;
+        for (int c = 0; c < condensed.getNumVertices(); c++) {
+            for (int e = condensed.edgeBegin(c); e < condensed.edgeEnd(c); e++) {
+                if (condensed.edgeTarget(e) >= c) randomMatch = false;  // Reverse topological IDs
+            }
+        }
+        
+        CSRGraph snapshot = randomGraph.freeze();
+        vector<vector<int>> reach(n);
+        for (int a = 0; a < n; a++) reach[a] = referenceLevels(snapshot, a);
+        for (int a = 0; a < n; a++) {
+            for (int b = 0; b < n; b++) {
+                bool expected = reach[a][b] >= 0;
+                if (closureIndex.canReach(a, b) != expected || searchIndex.canReach(a, b) != expected ||
+                    closureIndex.mutuallyReachable(a, b) != (expected && reach[b][a] >= 0)) randomMatch = false;
+            }
+        }
+    }
+    recordTest("Reachability vs BFS (Closure and Fallback)", randomMatch, 0.0);
+    
+    // 200k-station one-way corridor: every station is its own component
+    int length = 200000;
+    Graph corridor(length);
+    silenceOutput();
+    for (int i = 0; i < length; i++) corridor.addStation(i, "C" + to_string(i));
+    for (int i = 0; i + 1 < length; i++) corridor.addRoute(i, i + 1, 1);
+    restoreOutput();
+    start = high_resolution_clock::now();
+    bool fits = index.build(corridor);
+    end = high_resolution_clock::now();
+    bool corridorOk = !fits && index.getNumComponents() == length && index.canReach(0, length - 1) &&
+                      !index.canReach(length - 1, 0) && index.canReach(length / 2, length / 2 + 1);
+    recordTest("SCC on 200k Corridor", corridorOk, duration<double, milli>(end - start).count());
+}
+
+// ==================== BINARY GRAPH FILE TESTS ====================
+
+void testGraphFile() {
+    cout << "\n=== Testing Binary Graph File ===" << endl;
+    
+    // Grid with coordinates plus a sparse tail: station IDs with gaps and one-way routes
+    Graph graph(130);
+    silenceOutput();
+    buildGridGraph(graph, 10);
+    graph.addStation(120, "Harbour Terminal");
+    graph.addStation(129, "");
+    graph.addRoute(99, 120, 11);
+    graph.addRoute(120, 129, 3);
+    graph.deleteStation(55);
+    restoreOutput();
+    
+    auto start = high_resolution_clock::now();
+    bool written = MappedGraph::write(graph, "test_graph.bin");
+    auto end = high_resolution_clock::now();
+    recordTest("Graph File Write", written, duration<double, milli>(end - start).count());
+    
+    MappedGraph mapped;
+    start = high_resolution_clock::now();
+    bool opened = mapped.open("test_graph.bin");
+    end = high_resolution_clock::now();
+    bool same = opened && mapped.verify() && mapped.getNumVertices() == 130 &&
+                mapped.getNumStations() == 101 && mapped.getNumEdges() == graph.getNumRoutes() &&
+                mapped.stationName(120) == "Harbour Terminal" && mapped.stationExists(129) &&
+                mapped.stationName(129) == "" && !mapped.stationExists(55) && !mapped.stationExists(100) &&
+                mapped.getRouteWeight(99, 120) == 11 && mapped.getRouteWeight(120, 99) == -1;
+    double x = 0.0, y = 0.0;
+    same = same && mapped.stationCoordinates(23, x, y) && x == 3.0 && y == 2.0 &&
+           !mapped.stationCoordinates(120, x, y);
+    CSRGraph csr = graph.freeze();
+    for (int src = 0; src < 130 && same; src += 13) {
+        if (mapped.BFS(src) != csr.BFS(src)) same = false;
+        for (int dest = 1; dest < 130; dest += 17) {
+            int a = 0, b = 0;
+            if (mapped.shortestPath(src, dest, &a) != csr.shortestPath(src, dest, &b) || a != b) same = false;
+        }
+    }
+    recordTest("Graph File Mapped Queries", same, duration<double, milli>(end - start).count());
+    mapped.close();
+    
+    // Flip one weight byte: the header still parses, the checksum does not match
+    bool rejects = true;
+    FILE* file = fopen("test_graph.bin", "r+b");
+    if (file != nullptr) {
+        fseek(file, -5, SEEK_END);
+        int c = fgetc(file);
+        fseek(file, -5, SEEK_END);
+        fputc(c ^ 0x10, file);
+        fclose(file);
+    }
+    if (!mapped.open("test_graph.bin") || mapped.verify()) rejects = false;
+    mapped.close();
+    
+    // Truncated file and wrong version are refused at open()
+    file = fopen("test_graph.bin", "r+b");
+    if (file != nullptr) {
+        fseek(file, 4, SEEK_SET);
+        int future = 2;
+        fwrite(&future, sizeof(int), 1, file);
+        fclose(file);
+    }
+    if (mapped.open("test_graph.bin") || mapped.open("missing_graph.bin")) rejects = false;
+    Graph empty(0);
+    MappedGraph::write(empty, "test_graph.bin");
+    if (!mapped.open("test_graph.bin") || !mapped.verify() || mapped.getNumVertices() != 0 ||
+        !mapped.BFS(0).empty()) rejects = false;
+    mapped.close();
+    MappedGraph::write(graph, "test_graph.bin");
+    vector<char> bytes;
+    file = fopen("test_graph.bin", "rb");
+    if (file != nullptr) {
+        int c;
+        while ((c = fgetc(file)) != EOF) bytes.push_back((char)c);
+        fclose(file);
+    }
+    file = fopen("test_graph.bin", "wb");
+    if (file != nullptr) {
+        fwrite(&bytes[0], 1, bytes.size() - 8, file);  // Drop the last weights
+        fclose(file);
+    }
+    if (mapped.open("test_graph.bin")) rejects = false;
+    // Sizes intact but the first edge points past the last vertex: open() must
+    // refuse it without verify()
+    GraphFileHeader header;
+    memcpy(&header, &bytes[0], sizeof(header));
+    long long targetsAt = sizeof(GraphFileHeader) + (((long long)sizeof(StationRecord) * header.numStations + 7) & ~7LL) +
+                          ((4LL * header.numVertices + 7) & ~7LL) + ((header.stringPoolBytes + 7) & ~7LL) +
+                          ((4LL * (header.numVertices + 1) + 7) & ~7LL);
+    int badTarget = header.numVertices + 1000;
+    memcpy(&bytes[targetsAt], &badTarget, sizeof(int));
+    file = fopen("test_graph.bin", "wb");
+    if (file != nullptr) {
+        fwrite(&bytes[0], 1, bytes.size(), file);
+        fclose(file);
+    }
+    if (header.numEdges == 0 || mapped.open("test_graph.bin")) rejects = false;
+    remove("test_graph.bin");
+    recordTest("Graph File Rejects Corruption", rejects && !mapped.isOpen(), 0.0);
+}
+
+void writeTextFile(const string& filename, const string& text) {
+    FILE* file = fopen(filename.c_str(), "wb");
+    if (file == nullptr) return;
+    fwrite(text.data(), 1, text.size(), file);
+    fclose(file);
+}
+
+void testBulkLoader() {
+    cout << "\n=== Testing CSV Bulk Loader ===" << endl;
+    
+    // Number parsing: must agree bit for bit with strtod on the fast and slow paths
+    int parsed = 0;
+    bool numbers = CsvReader::parseInt("2147483647", 10, parsed) && parsed == 2147483647 &&
+                   CsvReader::parseInt("-2147483648", 11, parsed) && parsed == INT_MIN &&
+                   CsvReader::parseInt("+42", 3, parsed) && parsed == 42 &&
+                   !CsvReader::parseInt("2147483648", 10, parsed) && !CsvReader::parseInt("12a", 3, parsed) &&
+                   !CsvReader::parseInt("", 0, parsed) && !CsvReader::parseInt("-", 1, parsed);
+    const char* samples[] = {"0", "-0.5", "0.1", "3.14159", "60", "1e10", "2.5E-3", "123456.789",
+                             "1e-300", "1.7976931348623157e308", "12345678901234567890.5",
+                             "0.000000000000000000000001234", "9007199254740993", ".5", "7."};
+    for (int i = 0; i < 15; i++) {
+        double value = 0.0;
+        if (!CsvReader::parseDouble(samples[i], strlen(samples[i]), value) ||
+            value != strtod(samples[i], nullptr)) numbers = false;
+    }
+    unsigned int seed = 99;
+    for (int i = 0; i < 2000; i++) {
+        seed = seed * 1103515245 + 12345;
+        char text[64];
+        int length = snprintf(text, sizeof(text), "%.*f", (int)(seed >> 28) % 9, (seed >> 4) / 1000.0 - 100000.0);
+        double value = 0.0;
+        if (!CsvReader::parseDouble(text, length, value) || value != strtod(text, nullptr)) numbers = false;
+    }
+    double ignored = 0.0;
+    numbers = numbers && !CsvReader::parseDouble("", 0, ignored) && !CsvReader::parseDouble("1.2.3", 5, ignored) &&
+              !CsvReader::parseDouble("e5", 2, ignored) && !CsvReader::parseDouble("1e", 2, ignored) &&
+              !CsvReader::parseDouble("nan", 3, ignored);
+    recordTest("CSV Number Parsing", numbers, 0.0);
+    
+    // Header, quoting, spaces, CRLF, blank line, malformed lines, duplicate ID,
+    // and a last line without its newline
+    writeTextFile("test_stations.csv",
+                  "id,name,x,y\n0,Central,1.5,2.25\n1,\"Harbour, North\",3,4\n2,Airport\n\n"
+                  "3 , Spaced ,1e1,-0.5\r\nbad,line\n4,Too,Many,Fields,X\n1,Duplicate\n-5,Negative\n"
+                  "5,\"Say \"\"hi\"\"\"");
+    Graph graph(0);
+    BulkLoader loader;
+    LoadStats stats;
+    auto start = high_resolution_clock::now();
+    bool loaded = loader.loadStations("test_stations.csv", graph, &stats);
+    auto end = high_resolution_clock::now();
+    Station* harbour = graph.getStation(1);
+    Station* spaced = graph.getStation(3);
+    Station* quoted = graph.getStation(5);
+    bool stationsOk = loaded && stats.records == 6 && stats.rejected == 3 && stats.skipped == 1 &&
+                      stats.firstRejectedLine == 7 && graph.getNumVertices() == 6 &&
+                      harbour != nullptr && harbour->name == "Harbour, North" && harbour->x == 3.0 &&
+                      spaced != nullptr && spaced->name == "Spaced" && spaced->x == 10.0 && spaced->y == -0.5 &&
+                      quoted != nullptr && quoted->name == "Say \"hi\"" &&
+                      graph.getStation(2) != nullptr && !graph.getStation(2)->hasCoordinates &&
+                      !graph.stationExists(4);
+    
+    // Tiny buffer and batches: every record crosses a chunk boundary and the buffer grows
+    Graph small(0);
+    BulkLoader tinyLoader(4, 2);
+    LoadStats tinyStats;
+    stationsOk = stationsOk && tinyLoader.loadStations("test_stations.csv", small, &tinyStats) &&
+                 tinyStats.records == stats.records && tinyStats.rejected == stats.rejected &&
+                 tinyStats.bytes == stats.bytes && small.getAllStations().size() == graph.getAllStations().size() &&
+                 small.getStation(5) != nullptr && small.getStation(5)->name == quoted->name;
+    recordTest("Bulk Load Stations", stationsOk, duration<double, milli>(end - start).count());
+    
+    // Routes: update of an existing route, unknown station, malformed weight; the hub
+    // tree is rebuilt once at the end of the batch
+    silenceOutput();
+    graph.addHub(0);
+    restoreOutput();
+    writeTextFile("test_routes.csv", "source,destination,weight\n0,1,5\n1,2,7\n0,1,9\n2,99,1\n1,2,x\n-1,2,3\n2,0,4\n");
+    start = high_resolution_clock::now();
+    loaded = loader.loadRoutes("test_routes.csv", graph, &stats);
+    end = high_resolution_clock::now();
+    recordTest("Bulk Load Routes", loaded && stats.records == 5 && stats.rejected == 2 && stats.skipped == 1 &&
+               graph.getNumRoutes() == 3 && graph.getRouteWeight(0, 1) == 9 && graph.getRouteWeight(2, 0) == 4 &&
+               graph.hubDistance(0, 2) == 16, duration<double, milli>(end - start).count());
+    
+    // ID 4 is inside the vertex range but has no station (its line was malformed)
+    writeTextFile("test_routes.csv", "0,4,3\n");
+    loaded = loader.loadRoutes("test_routes.csv", graph, &stats);
+    recordTest("Bulk Load Routes Skip Missing Stations", loaded && stats.records == 1 && stats.skipped == 1 &&
+               !graph.stationExists(4) && graph.getRouteWeight(0, 4) == -1 && graph.getNumRoutes() == 3, 0.0);
+    
+    // Vehicles: a repeated ID updates the first record, as insert() does
+    writeTextFile("test_vehicles.csv", "id,type,model,capacity,speed\n100,Bus,CityBus,50,60.5\n"
+                  "101,Metro,FastTrain,200,80\n100,Bus,Articulated,90,55.25\n102,Tram,,x,30\n");
+    HashTable vehicles;
+    loaded = loader.loadVehicles("test_vehicles.csv", vehicles, &stats);
+    const Vehicle* bus = vehicles.search(100);
+    recordTest("Bulk Load Vehicles", loaded && stats.records == 3 && stats.rejected == 1 &&
+               vehicles.getNumVehicles() == 2 && bus != nullptr && bus->model == "Articulated" &&
+               bus->capacity == 90 && bus->speed == 55.25 && vehicles.search(101) != nullptr, 0.0);
+    
+    // Route metadata: unsorted with a repeated ID, merged into a tree that already has routes
+    BST routes;
+    silenceOutput();
+    routes.insert(RouteMetadata(4, "Old Four", 1, 1.0));
+    routes.insert(RouteMetadata(10, "Ten", 2, 2.0));
+    restoreOutput();
+    writeTextFile("test_metadata.csv", "7,Seven,70,7.5\n2,Two\n4,Four,40,4.0\n7,Seven Again,71,7.25\n1,One,10,1.5\n");
+    loaded = loader.loadRouteMetadata("test_metadata.csv", routes, &stats);
+    vector<RouteMetadata> all = routes.getAllRoutes();
+    int expectedIds[] = {1, 2, 4, 7, 10};
+    bool metadataOk = loaded && stats.records == 5 && routes.getSize() == 5 && all.size() == 5;
+    for (size_t i = 0; i < all.size() && metadataOk; i++) {
+        if (all[i].routeId != expectedIds[i]) metadataOk = false;
+    }
+    metadataOk = metadataOk && routes.search(4)->routeName == "Four" && routes.search(7)->routeName == "Seven Again" &&
+                 routes.search(7)->averageTime == 7.25 && routes.search(2)->passengerCount == 0;
+    
+    // Sorted batch of 100k routes (the order that degenerates one-by-one inserts)
+    vector<RouteMetadata> sortedBatch;
+    for (int i = 0; i < 100000; i++) sortedBatch.push_back(RouteMetadata(i, "R", i, 0.0));
+    BST large;
+    metadataOk = metadataOk && large.insertBatch(sortedBatch) == 100000 && large.getSize() == 100000 &&
+                 large.search(99999) != nullptr && large.search(31337)->passengerCount == 31337;
+    recordTest("Bulk Load Route Metadata", metadataOk, 0.0);
+    
+    // Passengers keep file order
+    writeTextFile("test_passengers.csv", "1,Alice,0,5\n2,Bob,1,2\n3,Carol\n4,Dan,3,4\n");
+    Queue passengers;
+    loaded = loader.loadPassengers("test_passengers.csv", passengers, &stats);
+    bool passengersOk = loaded && stats.records == 3 && stats.rejected == 1 && passengers.getSize() == 3 &&
+                        passengers.peek().name == "Alice";
+    silenceOutput();
+    passengers.dequeue();
+    restoreOutput();
+    passengersOk = passengersOk && passengers.peek().name == "Bob" && passengers.peek().destinationStation == 2;
+    passengersOk = passengersOk && !loader.loadPassengers("missing_passengers.csv", passengers);
+    recordTest("Bulk Load Passengers", passengersOk, 0.0);
+    
+    remove("test_stations.csv");
+    remove("test_routes.csv");
+    remove("test_vehicles.csv");
+    remove("test_metadata.csv");
+    remove("test_passengers.csv");
+}
+
+// Keeps every log line in memory
+class CaptureSink : public LogSink {
+public:
+    vector<LogLevel> levels;
+    vector<string> messages;
+    void write(LogLevel level, const string& message) {
+        levels.push_back(level);
+        messages.push_back(message);
+    }
+};
+
+// Flushes after every line, like the old cout << ... << endl
+class FlushingSink : public LogSink {
+public:
+    FILE* file;
+    FlushingSink(FILE* target) : file(target) {}
+    void write(LogLevel, const string& message) {
+        fputs(message.c_str(), file);
+        fputc('\n', file);
+        fflush(file);
+    }
+};
+
+int formatCalls = 0;
+int countFormat() {
+    formatCalls++;
+    return formatCalls;
+}
+
+void testLogger() {
+    cout << "\n=== Testing Logger ===" << endl;
+    
+    CaptureSink capture;
+    Logger::setSink(&capture);
+    Logger::setLevel(LOG_LEVEL_INFO);
+    
+    // Messages keep their text and carry a level
+    Graph graph(4);
+    graph.addStation(1, "Central");
+    graph.addStation(1, "Again");
+    graph.addStation(-3, "Invalid");
+    HashTable vehicles;
+    vehicles.remove(77);
+    bool levelsOk = capture.messages.size() == 4 &&
+                    capture.messages[0] == "Station 'Central' (ID: 1) added successfully!" &&
+                    capture.levels[0] == LOG_LEVEL_INFO && capture.levels[1] == LOG_LEVEL_WARNING &&
+                    capture.levels[2] == LOG_LEVEL_ERROR && capture.messages[3] == "Vehicle 77 not found!";
+    
+    // Below the threshold nothing is written and the message is not even formatted
+    LOG_DEBUG("Debug " << countFormat());
+    Logger::setLevel(LOG_LEVEL_WARNING);
+    graph.addStation(2, "North");
+    graph.addRoute(1, 2, 5);
+    graph.addRoute(1, 9, 5);
+    Logger::setLevel(LOG_LEVEL_OFF);
+    graph.addRoute(9, 1, 5);
+    LOG_ERROR("Error " << countFormat());
+    levelsOk = levelsOk && capture.messages.size() == 5 && capture.levels[4] == LOG_LEVEL_ERROR &&
+               capture.messages[4] == "Invalid station IDs!" && formatCalls == 0 &&
+               graph.getRouteWeight(1, 2) == 5 && graph.stationExists(2);
+    Logger::setSink(nullptr);
+    Logger::setLevel(LOG_LEVEL_INFO);
+    recordTest("Logger Levels and Sink", levelsOk && Logger::getSink() != &capture, 0.0);
+    
+    // File sink: lines reach the file in buffer-sized writes, all of them after flush()
+    FileSink file("test_log.txt");
+    Logger::setSink(&file);
+    for (int i = 0; i < 5000; i++) {
+        LOG_INFO("Line " << i);
+    }
+    LOG_ERROR(string(100000, 'x'));  // Larger than the buffer
+    Logger::flush();
+    Logger::setSink(nullptr);
+    ifstream in("test_log.txt");
+    string line;
+    int lines = 0;
+    bool fileOk = true;
+    while (getline(in, line)) {
+        if (lines < 5000 && line != "[INFO] Line " + to_string(lines)) fileOk = false;
+        if (lines == 5000 && line != "[ERROR] " + string(100000, 'x')) fileOk = false;
+        lines++;
+    }
+    in.close();
+    remove("test_log.txt");
+    recordTest("Logger Buffered File Sink", fileOk && lines == 5001, 0.0);
 }
 
 // ==================== QUEUE TESTS ====================
@@ -210,7 +1525,7 @@ void testHashTableOperations() {
     
     // Test 2: Search
     start = high_resolution_clock::now();
-    Vehicle* v = hashTable.search(101);
+    const Vehicle* v = hashTable.search(101);
     end = high_resolution_clock::now();
     time = duration<double, milli>(end - start).count();
     recordTest("Hash Table Search", v != nullptr && v->type == "Metro", time);
@@ -226,6 +1541,297 @@ void testHashTableOperations() {
     double loadFactor = hashTable.getLoadFactor();
     recordTest("Load Factor Calculation", loadFactor > 0, 0.0,
                "Load factor: " + to_string(loadFactor));
+    
+    // Test 5: Growth keeps every vehicle reachable and the load under the limit
+    Logger::setLevel(LOG_LEVEL_OFF);
+    HashTable growing(0.75);
+    start = high_resolution_clock::now();
+    for (int i = 0; i < 20000; i++) {
+        growing.insert(Vehicle(i * 37 - 5000, "Bus", "M" + to_string(i), i % 90, 40.0));
+    }
+    bool grown = growing.getNumVehicles() == 20000 && growing.getLoadFactor() <= 0.75 &&
+                 growing.getCapacity() >= 20000 / 0.75;
+    for (int i = 0; i < 20000 && grown; i++) {
+        const Vehicle* found = growing.search(i * 37 - 5000);
+        if (found == nullptr || found->model != "M" + to_string(i)) grown = false;
+    }
+    grown = grown && growing.search(-4999) == nullptr && growing.search(INT_MIN) == nullptr;
+    end = high_resolution_clock::now();
+    recordTest("Hash Table Growth", grown, duration<double, milli>(end - start).count(),
+               "Capacity " + to_string(growing.getCapacity()) + ", longest probe " +
+               to_string(growing.getLongestProbe()) + " group(s)");
+    
+    // Test 6: Random inserts, updates and removals agree with the chained table
+    HashTable open;
+    ChainedHashTable chained;
+    unsigned int seed = 5;
+    bool agree = true;
+    start = high_resolution_clock::now();
+    for (int op = 0; op < 100000 && agree; op++) {
+        seed = seed * 1103515245 + 12345;
+        int id = (seed >> 8) % 3000;
+        int kind = (seed >> 24) % 3;
+        if (kind == 0) {
+            open.insert(Vehicle(id, "Metro", "V" + to_string(op), op % 300, op % 120));
+            chained.insert(Vehicle(id, "Metro", "V" + to_string(op), op % 300, op % 120));
+        } else if (kind == 1) {
+            if (open.remove(id) != chained.remove(id)) agree = false;
+        } else {
+            const Vehicle* a = open.search(id);
+            Vehicle* b = chained.search(id);
+            if ((a == nullptr) != (b == nullptr) || (a != nullptr && (a->model != b->model || a->capacity != b->capacity))) {
+                agree = false;
+            }
+        }
+        if (open.getNumVehicles() != chained.getNumVehicles()) agree = false;
+    }
+    for (int id = 0; id < 3000 && agree; id++) {
+        if ((open.search(id) == nullptr) != (chained.search(id) == nullptr)) agree = false;
+    }
+    agree = agree && (int)open.getAllVehicles().size() == open.getNumVehicles();
+    end = high_resolution_clock::now();
+    recordTest("Hash Table Matches Chained", agree, duration<double, milli>(end - start).count());
+    
+    // Test 7: Insert/remove churn reuses tombstones instead of growing forever
+    HashTable churn;
+    for (int i = 0; i < 1000; i++) churn.insert(Vehicle(i, "Bus", "C", 10, 30.0));
+    int settledCapacity = churn.getCapacity();
+    for (int i = 1000; i < 500000; i++) {
+        churn.remove(i - 1000);
+        churn.insert(Vehicle(i, "Bus", "C", 10, 30.0));
+    }
+    bool bounded = churn.getNumVehicles() == 1000 && churn.getCapacity() <= settledCapacity * 2 &&
+                   churn.search(499999) != nullptr && churn.search(498999) == nullptr &&
+                   churn.search(499000) != nullptr;
+    Logger::setLevel(LOG_LEVEL_INFO);
+    recordTest("Hash Table Tombstone Reuse", bounded, 0.0,
+               "Capacity " + to_string(churn.getCapacity()) + " after 499k removals");
+    
+    // Test 8: Type and range queries
+    HashTable fleet;
+    silenceOutput();
+    fleet.insert(Vehicle(1, "Metro", "M1", 180, 80.0));
+    fleet.insert(Vehicle(2, "Bus", "B1", 60, 50.0));
+    fleet.insert(Vehicle(3, "Metro", "M2", 120, 90.0));
+    fleet.insert(Vehicle(4, "Metro", "M3", 150, 70.0));
+    fleet.insert(Vehicle(5, "Train", "T1", 400, 120.0));
+    restoreOutput();
+    VehicleFilter bigMetros;
+    bigMetros.type = "Metro";
+    bigMetros.minCapacity = 150;
+    vector<int> metros = fleet.findVehicles(bigMetros);
+    vector<int> fast = fleet.findBySpeed(80.0, 1000.0);
+    vector<int> mid = fleet.findByCapacity(100, 180);
+    bool queries = metros.size() == 2 && fast.size() == 3 && fast[0] == 1 && fast[2] == 5 &&
+                   mid.size() == 3 && mid[0] == 3 && mid[1] == 4 && mid[2] == 1 &&
+                   fleet.countByType("Metro") == 3 && fleet.findByType("Tram").empty() && fleet.getNumTypes() == 3;
+    fleet.updateTelemetry(3, 200, 85.0);                       // Now a big Metro
+    fleet.update(Vehicle(1, "Bus", "B2", 180, 80.0));          // No longer a Metro
+    silenceOutput();
+    fleet.remove(4);
+    restoreOutput();
+    metros = fleet.findVehicles(bigMetros);
+    queries = queries && metros.size() == 1 && metros[0] == 3 && fleet.countByType("Bus") == 2 &&
+              fleet.findByCapacity(150, 150).empty() && fleet.findBySpeed(85.0, 85.0).size() == 1;
+    recordTest("Vehicle Index Queries", queries, 0.0);
+    
+    // Test 9: Indexes agree with full scans through random inserts, batches,
+    // updates and removals
+    const char* types[4] = {"Bus", "Metro", "Train", "Tram"};
+    HashTable indexed;
+    seed = 23;
+    bool consistent = true;
+    Logger::setLevel(LOG_LEVEL_OFF);
+    start = high_resolution_clock::now();
+    for (int op = 0; op < 60000 && consistent; op++) {
+        seed = seed * 1103515245 + 12345;
+        int id = (seed >> 8) % 4000;
+        int kind = (seed >> 24) % 5;
+        int capacity = (seed >> 12) % 300;
+        double speed = ((seed >> 4) % 240) * 0.5;
+        const char* type = types[(seed >> 20) % 4];
+        if (kind == 0) {
+            indexed.insert(Vehicle(id, type, "I", capacity, speed));
+        } else if (kind == 1) {
+            vector<Vehicle> batch;
+            for (int b = 0; b < 8; b++) batch.push_back(Vehicle((id + b * 97) % 4000, types[b % 4], "B", capacity + b, speed));
+            indexed.insertBatch(batch);
+        } else if (kind == 2) {
+            indexed.remove(id);
+        } else if (kind == 3) {
+            indexed.updateTelemetry(id, capacity, speed);
+        } else {
+            indexed.update(Vehicle(id, type, "U", capacity, speed));
+        }
+        if (op % 500 != 0) continue;
+        
+        VehicleFilter filter;
+        filter.type = ((seed >> 2) % 5 == 4) ? "" : types[(seed >> 2) % 5];
+        filter.minCapacity = (seed >> 6) % 200;
+        filter.maxCapacity = filter.minCapacity + (seed >> 14) % 150;
+        filter.minSpeed = (seed >> 10) % 60;
+        filter.maxSpeed = filter.minSpeed + (seed >> 18) % 80;
+        vector<int> found = indexed.findVehicles(filter);
+        vector<char> inResult(4000, 0);
+        for (size_t i = 0; i < found.size(); i++) inResult[found[i]]++;
+        const vector<Vehicle>& all = indexed.getAllVehicles();
+        int expected = 0;
+        for (size_t i = 0; i < all.size(); i++) {
+            const Vehicle& v = all[i];
+            bool match = (filter.type.empty() || v.type == filter.type) && v.capacity >= filter.minCapacity &&
+                         v.capacity <= filter.maxCapacity && v.speed >= filter.minSpeed && v.speed <= filter.maxSpeed;
+            if (match) expected++;
+            if (inResult[v.id] != (match ? 1 : 0)) consistent = false;
+        }
+        int typeTotal = 0;
+        for (int t = 0; t < 4; t++) typeTotal += indexed.countByType(types[t]);
+        consistent = consistent && (int)found.size() == expected && typeTotal == indexed.getNumVehicles() &&
+                     (int)indexed.findByCapacity(INT_MIN, INT_MAX).size() == indexed.getNumVehicles() &&
+                     (int)indexed.findBySpeed(-1.0, 1000.0).size() == indexed.getNumVehicles();
+    }
+    Logger::setLevel(LOG_LEVEL_INFO);
+    end = high_resolution_clock::now();
+    recordTest("Vehicle Indexes Match Scans", consistent, duration<double, milli>(end - start).count(),
+               to_string(indexed.getNumVehicles()) + " vehicles, " + to_string(indexed.getNumTypes()) + " types");
+}
+
+// ==================== VEHICLE REGISTRY TESTS ====================
+
+void testVehicleRegistry() {
+    cout << "\n=== Testing Concurrent Vehicle Registry ===" << endl;
+    
+    // Test 1: Single-threaded behaviour matches HashTable
+    VehicleRegistry registry(8);
+    auto start = high_resolution_clock::now();
+    bool basic = registry.insert(Vehicle(100, "Bus", "CityBus", 50, 60.0)) &&
+                 registry.insert(Vehicle(101, "Metro", "FastTrain", 200, 80.0)) &&
+                 !registry.insert(Vehicle(100, "Bus", "CityBus2", 55, 62.0)) &&
+                 registry.getNumVehicles() == 2;
+    Vehicle found(0, "", "", 0, 0.0);
+    basic = basic && registry.lookup(100, found) && found.model == "CityBus2" && found.capacity == 55;
+    int capacity = 0;
+    double speed = 0.0;
+    basic = basic && registry.updateTelemetry(101, 180, 75.5) && registry.getTelemetry(101, capacity, speed) &&
+            capacity == 180 && speed == 75.5 && registry.lookup(101, found) && found.model == "FastTrain";
+    basic = basic && !registry.updateTelemetry(999, 1, 1.0) && registry.remove(100) && !registry.remove(100) &&
+            !registry.contains(100) && registry.contains(101) && registry.getNumVehicles() == 1;
+    recordTest("Registry Insert/Lookup/Update", basic,
+               duration<double, milli>(high_resolution_clock::now() - start).count());
+    
+    // Test 2: Random operations agree with HashTable across growth and tombstones
+    Logger::setLevel(LOG_LEVEL_OFF);
+    VehicleRegistry random(4);
+    HashTable reference;
+    unsigned int seed = 11;
+    bool agree = true;
+    start = high_resolution_clock::now();
+    for (int op = 0; op < 200000 && agree; op++) {
+        seed = seed * 1103515245 + 12345;
+        int id = (seed >> 8) % 5000 - 100;
+        int kind = (seed >> 24) % 4;
+        if (kind == 0) {
+            Vehicle vehicle(id, "Bus", "V" + to_string(op), op % 300, op % 120);
+            if (random.insert(vehicle) != (reference.search(id) == nullptr)) agree = false;
+            reference.insert(vehicle);
+        } else if (kind == 1) {
+            if (random.remove(id) != reference.remove(id)) agree = false;
+        } else if (kind == 2) {
+            bool present = reference.updateTelemetry(id, op % 77, op * 0.25);
+            if (random.updateTelemetry(id, op % 77, op * 0.25) != present) agree = false;
+        } else {
+            const Vehicle* expected = reference.search(id);
+            bool present = random.lookup(id, found);
+            if (present != (expected != nullptr) ||
+                (present && (found.model != expected->model || found.capacity != expected->capacity ||
+                             found.speed != expected->speed))) {
+                agree = false;
+            }
+        }
+        if (random.getNumVehicles() != reference.getNumVehicles()) agree = false;
+    }
+    Logger::setLevel(LOG_LEVEL_INFO);
+    recordTest("Registry Matches Hash Table", agree,
+               duration<double, milli>(high_resolution_clock::now() - start).count());
+    
+    // Test 3: Telemetry writers and dispatch readers at the same time. Writer w
+    // owns IDs [w * 1000, w * 1000 + 1000) and always publishes speed ==
+    // capacity / 2, so a reader that ever sees a torn or freed record fails.
+    int writers = 4;
+    int readerTasks = 4;
+    int idsPerWriter = 1000;
+    VehicleRegistry shared(16);
+    vector<vector<int> > expected(writers, vector<int>(idsPerWriter, -1));  // -1 = absent
+    atomic<long long> reads(0);
+    atomic<long long> violations(0);
+    ThreadPool pool(writers + readerTasks);
+    start = high_resolution_clock::now();
+    pool.parallelFor(writers + readerTasks, [&](int task, int) {
+        unsigned int taskSeed = 1000 + task;
+        if (task % 2 == 0) {
+            int w = task / 2;
+            vector<int>& mine = expected[w];
+            for (int op = 0; op < 200000; op++) {
+                taskSeed = taskSeed * 1103515245 + 12345;
+                int local = (taskSeed >> 8) % idsPerWriter;
+                int id = w * idsPerWriter + local;
+                int newCapacity = (taskSeed >> 20) % 400;
+                int kind = op % 10;
+                if (kind == 0) {
+                    shared.remove(id);
+                    mine[local] = -1;
+                } else if (kind < 3 || mine[local] < 0) {
+                    shared.insert(Vehicle(id, "Bus", "Telemetry", newCapacity, newCapacity * 0.5));
+                    mine[local] = newCapacity;
+                } else {
+                    shared.updateTelemetry(id, newCapacity, newCapacity * 0.5);
+                    mine[local] = newCapacity;
+                }
+            }
+        } else {
+            Vehicle seen(0, "", "", 0, 0.0);
+            long long bad = 0;
+            long long done = 0;
+            for (int op = 0; op < 400000; op++) {
+                taskSeed = taskSeed * 1103515245 + 12345;
+                int id = (taskSeed >> 8) % (writers * idsPerWriter);
+                int seenCapacity = 0;
+                double seenSpeed = 0.0;
+                if (op % 2 == 0) {
+                    if (shared.lookup(id, seen) &&
+                        (seen.id != id || seen.speed != seen.capacity * 0.5 || seen.type != "Bus" ||
+                         seen.model != "Telemetry")) {
+                        bad++;
+                    }
+                } else if (shared.getTelemetry(id, seenCapacity, seenSpeed) && seenSpeed != seenCapacity * 0.5) {
+                    bad++;
+                }
+                done++;
+            }
+            reads += done;
+            violations += bad;
+        }
+    });
+    double stressTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    bool consistent = violations.load() == 0;
+    int live = 0;
+    for (int w = 0; w < writers && consistent; w++) {
+        for (int local = 0; local < idsPerWriter; local++) {
+            int id = w * idsPerWriter + local;
+            int finalCapacity = -1;
+            double finalSpeed = 0.0;
+            if (!shared.getTelemetry(id, finalCapacity, finalSpeed)) finalCapacity = -1;
+            if (finalCapacity != expected[w][local]) consistent = false;
+            if (expected[w][local] >= 0) live++;
+        }
+    }
+    consistent = consistent && shared.getNumVehicles() == live;
+    recordTest("Registry Concurrent Stress", consistent, stressTime,
+               to_string(reads.load()) + " reads, " + to_string(violations.load()) + " torn");
+    
+    // Test 4: With no reader active every retired record has been or can be freed
+    long long pending = shared.getPendingReclaim();
+    recordTest("Registry Reclamation Bounded", pending < (long long)shared.getNumShards() * 64, 0.0,
+               to_string(pending) + " retired records pending");
 }
 
 // ==================== BST TESTS ====================
@@ -414,6 +2020,1349 @@ void performanceTest() {
     }
 }
 
+// Heap-based vs linear-scan Dijkstra on synthetic grids
+void benchmarkShortestPath() {
+    cout << "\n=== Shortest Path Benchmark (Grid Networks) ===" << endl;
+    
+    vector<int> sizes = {1000, 10000, 100000};
+    
+    for (int size : sizes) {
+        int side = (int)ceil(sqrt((double)size));
+        Graph graph(side * side);
+        silenceOutput();
+        buildGridGraph(graph, side);
+        restoreOutput();
+        
+        int src = 0;
+        int dest = side * side - 1;
+        
+        silenceOutput();
+        auto start = high_resolution_clock::now();
+        vector<int> heapPath = graph.shortestPath(src, dest);
+        auto end = high_resolution_clock::now();
+        double heapTime = duration<double, milli>(end - start).count();
+        
+        start = high_resolution_clock::now();
+        vector<int> scanPath = graph.shortestPathLinearScan(src, dest);
+        end = high_resolution_clock::now();
+        double scanTime = duration<double, milli>(end - start).count();
+        restoreOutput();
+        
+        cout << "\n" << side * side << " stations (" << side << "x" << side << " grid):" << endl;
+        cout << "  Linear Scan Dijkstra: " << fixed << setprecision(3) << scanTime << " ms" << endl;
+        cout << "  Binary Heap Dijkstra: " << heapTime << " ms" << endl;
+        recordTest("Grid Dijkstra " + to_string(side * side), heapPath == scanPath, heapTime,
+                   "Speedup: " + to_string(scanTime / (heapTime > 0 ? heapTime : 1e-6)) + "x");
+    }
+}
+
+// Linked-list Graph vs CSR snapshot on repeated read-only queries
+void benchmarkCSRGraph() {
+    cout << "\n=== CSR Snapshot Benchmark (100x100 Grid) ===" << endl;
+    
+    int side = 100;
+    int queries = 50;
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side);
+    restoreOutput();
+    
+    auto start = high_resolution_clock::now();
+    CSRGraph csr = graph.freeze();
+    auto end = high_resolution_clock::now();
+    cout << "  Freeze: " << fixed << setprecision(3)
+         << duration<double, milli>(end - start).count() << " ms" << endl;
+    
+    bool same = true;
+    double listTime = 0.0;
+    double csrTime = 0.0;
+    silenceOutput();
+    for (int q = 0; q < queries; q++) {
+        int src = (q * 7919) % (side * side);
+        int dest = (q * 104729 + 17) % (side * side);
+        
+        start = high_resolution_clock::now();
+        vector<int> a = graph.BFS(src);
+        vector<int> b = graph.DFS(src);
+        vector<int> c = graph.shortestPath(src, dest);
+        end = high_resolution_clock::now();
+        listTime += duration<double, milli>(end - start).count();
+        
+        start = high_resolution_clock::now();
+        vector<int> x = csr.BFS(src);
+        vector<int> y = csr.DFS(src);
+        vector<int> z = csr.shortestPath(src, dest);
+        end = high_resolution_clock::now();
+        csrTime += duration<double, milli>(end - start).count();
+        
+        if (a != x || b != y || c != z) same = false;
+    }
+    restoreOutput();
+    
+    cout << "  Linked lists: " << listTime << " ms for " << queries << " BFS+DFS+Dijkstra rounds" << endl;
+    cout << "  CSR arrays:   " << csrTime << " ms" << endl;
+    recordTest("CSR Read Throughput", same, csrTime,
+               "Speedup: " + to_string(listTime / (csrTime > 0 ? csrTime : 1e-6)) + "x");
+}
+
+// Bulk route loading with pooled edge nodes and O(1) tail append
+void benchmarkRouteLoading() {
+    cout << "\n=== Route Loading Benchmark ===" << endl;
+    
+    int numStations = 100000;
+    int routesPerStation = 10;
+    Graph graph(numStations);
+    
+    silenceOutput();
+    auto start = high_resolution_clock::now();
+    for (int i = 0; i < numStations; i++) {
+        graph.addStation(i, "S");
+    }
+    unsigned int seed = 2024;
+    for (int i = 0; i < numStations; i++) {
+        for (int k = 0; k < routesPerStation; k++) {
+            seed = seed * 1103515245 + 12345;
+            graph.addRoute(i, (seed >> 8) % numStations, 1 + k);
+        }
+    }
+    auto end = high_resolution_clock::now();
+    restoreOutput();
+    double loadTime = duration<double, milli>(end - start).count();
+    
+    // One hub with a very high degree (the old push_back walked the whole list)
+    Graph hubGraph(20001);
+    silenceOutput();
+    start = high_resolution_clock::now();
+    for (int i = 0; i <= 20000; i++) {
+        hubGraph.addStation(i, "H");
+    }
+    for (int i = 1; i <= 20000; i++) {
+        hubGraph.addRoute(i, 0, 1);
+        hubGraph.addRoute(0, i, 1);
+    }
+    end = high_resolution_clock::now();
+    restoreOutput();
+    double hubTime = duration<double, milli>(end - start).count();
+    
+    cout << "  " << graph.getNumRoutes() << " routes over " << numStations << " stations: "
+         << fixed << setprecision(3) << loadTime << " ms ("
+         << (int)(graph.getNumRoutes() / (loadTime / 1000.0)) << " routes/sec)" << endl;
+    cout << "  Hub with " << hubGraph.getNumRoutes() / 2 << " outgoing routes: " << hubTime << " ms" << endl;
+    recordTest("Route Loading", graph.getNumRoutes() > 0, loadTime);
+}
+
+// Dijkstra vs A* (Euclidean heuristic) point-to-point on a large grid
+void benchmarkAStar() {
+    cout << "\n=== A* vs Dijkstra Benchmark (317x317 Grid) ===" << endl;
+    
+    // Travel time per unit length between 10 and 14, like a road network
+    int side = 317;
+    int queries = 20;
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side, 10, 14);
+    restoreOutput();
+    CoordinateHeuristic euclidean(graph);
+    
+    long long dijkstraSettled = 0, aStarSettled = 0;
+    double dijkstraTime = 0.0, aStarTime = 0.0;
+    bool same = true;
+    for (int q = 0; q < queries; q++) {
+        int src = (q * 7919) % (side * side);
+        int dest = (q * 104729 + 17) % (side * side);
+        SearchStats d, a;
+        silenceOutput();
+        graph.shortestPath(src, dest, &d);
+        restoreOutput();
+        graph.aStar(src, dest, euclidean, &a);
+        dijkstraSettled += d.settledNodes;
+        aStarSettled += a.settledNodes;
+        dijkstraTime += d.elapsedMs;
+        aStarTime += a.elapsedMs;
+        if (d.distance != a.distance) same = false;
+    }
+    
+    cout << "  Max network speed: " << fixed << setprecision(3) << euclidean.getMaxSpeed() << endl;
+    cout << "  Dijkstra: " << dijkstraSettled / queries << " settled/query, "
+         << dijkstraTime / queries << " ms/query" << endl;
+    cout << "  A*:       " << aStarSettled / queries << " settled/query, "
+         << aStarTime / queries << " ms/query" << endl;
+    recordTest("A* Settled Nodes", same && aStarSettled <= dijkstraSettled, aStarTime / queries);
+}
+
+// Bidirectional vs unidirectional Dijkstra: settled vertices and latency
+void benchmarkBidirectional() {
+    cout << "\n=== Bidirectional Dijkstra Benchmark (317x317 Grid) ===" << endl;
+    
+    int side = 317;
+    int queries = 20;
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side);
+    restoreOutput();
+    
+    long long dijkstraSettled = 0, biSettled = 0;
+    double dijkstraTime = 0.0, biTime = 0.0;
+    bool same = true;
+    for (int q = 0; q < queries; q++) {
+        int src = (q * 7919) % (side * side);
+        int dest = (q * 104729 + 17) % (side * side);
+        SearchStats d, b;
+        silenceOutput();
+        graph.shortestPath(src, dest, &d);
+        restoreOutput();
+        graph.shortestPathBidirectional(src, dest, &b);
+        dijkstraSettled += d.settledNodes;
+        biSettled += b.settledNodes;
+        dijkstraTime += d.elapsedMs;
+        biTime += b.elapsedMs;
+        if (d.distance != b.distance) same = false;
+    }
+    
+    cout << "  Dijkstra:      " << dijkstraSettled / queries << " settled/query, "
+         << fixed << setprecision(3) << dijkstraTime / queries << " ms/query" << endl;
+    cout << "  Bidirectional: " << biSettled / queries << " settled/query, "
+         << biTime / queries << " ms/query" << endl;
+    recordTest("Bidirectional Settled Nodes", same && biSettled <= dijkstraSettled, biTime / queries);
+}
+
+// ALT vs Euclidean A* vs Dijkstra: preprocessing, reload and settled vertices
+void benchmarkLandmarks() {
+    cout << "\n=== Landmark A* (ALT) Benchmark (317x317 Grid) ===" << endl;
+    
+    int side = 317;
+    int queries = 20;
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side, 10, 14);
+    restoreOutput();
+    CoordinateHeuristic euclidean(graph);
+    
+    auto start = high_resolution_clock::now();
+    LandmarkHeuristic landmarks(graph, 16, LandmarkHeuristic::AVOID);
+    double buildTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    landmarks.save("bench_landmarks.bin");
+    LandmarkHeuristic reloaded;
+    start = high_resolution_clock::now();
+    bool loaded = reloaded.load("bench_landmarks.bin");
+    double loadTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    remove("bench_landmarks.bin");
+    
+    long long dijkstraSettled = 0, euclideanSettled = 0, altSettled = 0;
+    double dijkstraTime = 0.0, euclideanTime = 0.0, altTime = 0.0;
+    bool same = loaded;
+    for (int q = 0; q < queries; q++) {
+        int src = (q * 7919) % (side * side);
+        int dest = (q * 104729 + 17) % (side * side);
+        SearchStats d, e, a;
+        silenceOutput();
+        graph.shortestPath(src, dest, &d);
+        restoreOutput();
+        graph.aStar(src, dest, euclidean, &e);
+        graph.aStar(src, dest, reloaded, &a);
+        dijkstraSettled += d.settledNodes;
+        euclideanSettled += e.settledNodes;
+        altSettled += a.settledNodes;
+        dijkstraTime += d.elapsedMs;
+        euclideanTime += e.elapsedMs;
+        altTime += a.elapsedMs;
+        if (d.distance != a.distance) same = false;
+    }
+    
+    cout << "  16 landmarks: " << fixed << setprecision(3) << buildTime << " ms to build, "
+         << loadTime << " ms to load" << endl;
+    cout << "  Dijkstra:    " << dijkstraSettled / queries << " settled/query, "
+         << dijkstraTime / queries << " ms/query" << endl;
+    cout << "  A* (coords): " << euclideanSettled / queries << " settled/query, "
+         << euclideanTime / queries << " ms/query" << endl;
+    cout << "  A* (ALT):    " << altSettled / queries << " settled/query, "
+         << altTime / queries << " ms/query" << endl;
+    recordTest("ALT Settled Nodes", same && altSettled <= dijkstraSettled, altTime / queries);
+}
+
+// Distance matrix throughput from 1 thread up to one per hardware core
+void benchmarkDistanceMatrix() {
+    int cores = ThreadPool::hardwareThreads();
+    cout << "\n=== Distance Matrix Scaling Benchmark (317x317 Grid, " << cores << " cores) ===" << endl;
+    
+    int side = 317;
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side);
+    restoreOutput();
+    
+    // 64 depots x 20k stops, spread pseudo-randomly over the grid
+    vector<int> sources, targets;
+    unsigned int seed = 4242;
+    for (int i = 0; i < 64; i++) {
+        seed = seed * 1103515245 + 12345;
+        sources.push_back((seed >> 8) % (side * side));
+    }
+    for (int i = 0; i < 20000; i++) {
+        seed = seed * 1103515245 + 12345;
+        targets.push_back((seed >> 8) % (side * side));
+    }
+    
+    double baseTime = 0.0;
+    vector<int> baseline;
+    bool same = true;
+    for (int threads = 1; ; threads *= 2) {
+        if (threads > cores) threads = cores;
+        auto start = high_resolution_clock::now();
+        vector<int> matrix = graph.distanceMatrix(sources, targets, threads);
+        double elapsed = duration<double, milli>(high_resolution_clock::now() - start).count();
+        if (threads == 1) {
+            baseTime = elapsed;
+            baseline.swap(matrix);
+        } else if (matrix != baseline) {
+            same = false;
+        }
+        cout << "  " << threads << " thread(s): " << fixed << setprecision(3) << elapsed << " ms, "
+             << (long long)(sources.size() * targets.size() / (elapsed / 1000.0)) << " entries/s, speedup "
+             << setprecision(2) << baseTime / elapsed << "x" << endl;
+        if (threads == cores) break;
+    }
+    recordTest("Distance Matrix 64x20000", same && baseline.size() == sources.size() * targets.size(), baseTime);
+}
+
+// Time-dependent routing with 96-slot (15 minute) daily profiles on every route
+void benchmarkTimeDependent() {
+    cout << "\n=== Time-Dependent Routing Benchmark (317x317 Grid, 96 Slots) ===" << endl;
+    
+    int side = 317;
+    int queries = 10;
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side);
+    restoreOutput();
+    
+    // Each route peaks at 1.5x - 3x its static weight around 08:00 and 17:30;
+    // routes with the same weight and peak factor share one profile
+    vector<int> slotTimes(96);
+    for (int i = 0; i < 96; i++) slotTimes[i] = i * 15;
+    unsigned int seed = 777;
+    int routes = 0;
+    auto start = high_resolution_clock::now();
+    silenceOutput();
+    for (int u = 0; u < side * side; u++) {
+        int neighbours[4] = {u - side, u + side, (u % side) ? u - 1 : -1, (u % side != side - 1) ? u + 1 : -1};
+        for (int k = 0; k < 4; k++) {
+            int v = neighbours[k];
+            if (v < 0 || v >= side * side) continue;
+            int w = graph.getRouteWeight(u, v);
+            seed = seed * 1103515245 + 12345;
+            int peakTenths = 15 + (seed >> 16) % 16;
+            vector<int> values(96);
+            for (int i = 0; i < 96; i++) {
+                int fromMorning = i > 32 ? i - 32 : 32 - i;   // Slots away from 08:00
+                int fromEvening = i > 70 ? i - 70 : 70 - i;   // Slots away from 17:30
+                int closest = fromMorning < fromEvening ? fromMorning : fromEvening;
+                int bump = closest < 8 ? 8 - closest : 0;     // 0..8
+                values[i] = w + w * (peakTenths - 10) * bump / 80;
+            }
+            graph.setRouteProfile(u, v, graph.addTravelTimeProfile(slotTimes, values));
+            routes++;
+        }
+    }
+    restoreOutput();
+    double attachTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    
+    const TravelTimeProfiles& store = graph.getProfiles();
+    long long edgeBytes = (long long)routes * sizeof(Edge) * 2;  // Forward and reverse lists
+    cout << "  " << routes << " routes, " << store.getNumProfiles() << " distinct profiles, "
+         << store.getNumPoints() << " breakpoints, attached in " << fixed << setprecision(3)
+         << attachTime << " ms" << endl;
+    cout << "  Profile store: " << store.getMemoryUsage() / 1024 << " KB; edges: "
+         << edgeBytes / 1024 << " KB (" << (double)(edgeBytes + store.getMemoryUsage()) / routes
+         << " bytes/route)" << endl;
+    cout << "  Worst case, every route with its own 96-slot profile: "
+         << 96 * 2 * sizeof(int) + 2 * sizeof(Edge) + sizeof(int) << " bytes/route" << endl;
+    
+    double staticTime = 0.0, offPeakTime = 0.0, peakTime = 0.0;
+    long long offPeakTravel = 0, peakTravel = 0, staticTravel = 0;
+    // Trips of 12 x 12 blocks (about two hours) so an off-peak journey ends before the morning peak
+    for (int q = 0; q < queries; q++) {
+        int src = ((q * 7919) % (side - 12)) * side + (q * 104729) % (side - 12);
+        int dest = src + 12 * side + 12;
+        SearchStats d, off, rushHour;
+        silenceOutput();
+        graph.shortestPath(src, dest, &d);
+        restoreOutput();
+        graph.shortestPathAt(src, dest, 3 * 60, &off);
+        graph.shortestPathAt(src, dest, 8 * 60, &rushHour);
+        staticTime += d.elapsedMs;
+        offPeakTime += off.elapsedMs;
+        peakTime += rushHour.elapsedMs;
+        staticTravel += d.distance;
+        offPeakTravel += off.distance;
+        peakTravel += rushHour.distance;
+    }
+    cout << "  Static Dijkstra:     " << staticTime / queries << " ms/query, avg travel " << staticTravel / queries << endl;
+    cout << "  Depart 03:00 (TD):   " << offPeakTime / queries << " ms/query, avg travel " << offPeakTravel / queries << endl;
+    cout << "  Depart 08:00 (TD):   " << peakTime / queries << " ms/query, avg travel " << peakTravel / queries << endl;
+    recordTest("Time-Dependent Queries", offPeakTravel == staticTravel && peakTravel > offPeakTravel,
+               peakTime / queries);
+}
+
+// Synthetic city timetable: a side x side grid of stops, bus lines in both
+// directions along every third row and column, a trip every 10 minutes from
+// 05:00 to 23:00 (times in seconds), and 2 minute walks between grid neighbours
+void buildSyntheticTimetable(Graph& network, Timetable& timetable, int side) {
+    for (int i = 0; i < side * side; i++) {
+        network.addStation(i, "Stop " + to_string(i));
+    }
+    unsigned int seed = 31337;
+    for (int line = 0; line < side; line += 3) {
+        for (int vertical = 0; vertical < 2; vertical++) {
+            vector<int> stops(side);
+            vector<int> hop(side, 0);  // Seconds from the previous stop, fixed per line
+            for (int i = 0; i < side; i++) {
+                stops[i] = vertical ? i * side + line : line * side + i;
+                seed = seed * 1103515245 + 12345;
+                if (i > 0) hop[i] = 60 + (seed >> 8) % 61;
+            }
+            for (int direction = 0; direction < 2; direction++) {
+                vector<int> ordered(side), gaps(side, 0);
+                for (int i = 0; i < side; i++) {
+                    ordered[i] = direction ? stops[side - 1 - i] : stops[i];
+                    if (i > 0) gaps[i] = direction ? hop[side - i] : hop[i];
+                }
+                int route = timetable.addRoute(ordered);
+                seed = seed * 1103515245 + 12345;
+                for (int start = 5 * 3600 + (seed >> 8) % 600; start < 23 * 3600; start += 600) {
+                    vector<int> times(side);
+                    int time = start;
+                    for (int i = 0; i < side; i++) {
+                        time += gaps[i];
+                        times[i] = time;
+                    }
+                    timetable.addTrip(route, times, times);
+                }
+            }
+        }
+    }
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) {
+                timetable.addTransfer(u, u + 1, 120);
+                timetable.addTransfer(u + 1, u, 120);
+            }
+            if (r + 1 < side) {
+                timetable.addTransfer(u, u + side, 120);
+                timetable.addTransfer(u + side, u, 120);
+            }
+        }
+    }
+}
+
+// RAPTOR one-to-one and one-to-all latency on a city-scale synthetic timetable
+void benchmarkTimetable() {
+    cout << "\n=== RAPTOR Timetable Benchmark (99x99 Synthetic City) ===" << endl;
+    
+    int side = 99;
+    Graph network(side * side);
+    Timetable timetable(network);
+    silenceOutput();
+    buildSyntheticTimetable(network, timetable, side);
+    restoreOutput();
+    
+    auto start = high_resolution_clock::now();
+    timetable.finalize();
+    double finalizeTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    cout << "  " << side * side << " stops, " << timetable.getNumRoutes() << " routes, "
+         << timetable.getNumTrips() << " trips, " << timetable.getNumStopTimes() << " stop times, "
+         << timetable.getNumTransfers() << " transfers" << endl;
+    cout << "  Finalize: " << fixed << setprecision(3) << finalizeTime << " ms" << endl;
+    
+    int queries = 200;
+    int departure = 8 * 3600 + 14 * 60;  // 08:14
+    vector<int> sources(queries), targets(queries);
+    unsigned int seed = 555;
+    for (int q = 0; q < queries; q++) {
+        seed = seed * 1103515245 + 12345;
+        sources[q] = (seed >> 8) % (side * side);
+        seed = seed * 1103515245 + 12345;
+        targets[q] = (seed >> 8) % (side * side);
+    }
+    
+    vector<int> oneToOne(queries);
+    long long rounds = 0;
+    start = high_resolution_clock::now();
+    for (int q = 0; q < queries; q++) {
+        oneToOne[q] = timetable.earliestArrival(sources[q], targets[q], departure);
+        rounds += timetable.getLastRounds();
+    }
+    double oneToOneTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    
+    int allQueries = 20;
+    bool consistent = true;
+    long long reached = 0;
+    start = high_resolution_clock::now();
+    for (int q = 0; q < allQueries; q++) {
+        vector<int> arrival = timetable.earliestArrivalAll(sources[q], departure);
+        if (arrival[targets[q]] != oneToOne[q]) consistent = false;
+        for (size_t i = 0; i < arrival.size(); i++) {
+            if (arrival[i] != INT_MAX) reached++;
+        }
+    }
+    double oneToAllTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    
+    cout << "  One-to-one: " << oneToOneTime / queries << " ms/query, "
+         << (double)rounds / queries << " rounds on average" << endl;
+    cout << "  One-to-all: " << oneToAllTime / allQueries << " ms/query, "
+         << reached / allQueries << " stops reached" << endl;
+    recordTest("RAPTOR City Queries", consistent && reached > 0, oneToOneTime / queries);
+}
+
+// Yen's k shortest paths, k = 10, on a ~100k-route grid
+void benchmarkKShortestPaths() {
+    cout << "\n=== K Shortest Paths Benchmark (158x158 Grid, k = 10) ===" << endl;
+    
+    int side = 158;
+    int queries = 10;
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side);
+    restoreOutput();
+    
+    double total = 0.0, worst = 0.0;
+    bool valid = true;
+    for (int q = 0; q < queries; q++) {
+        int src = (q * 7919) % (side * side);
+        int dest = (q * 104729 + 17) % (side * side);
+        vector<int> costs;
+        auto start = high_resolution_clock::now();
+        vector<vector<int>> paths = graph.kShortestPaths(src, dest, 10, &costs);
+        double elapsed = duration<double, milli>(high_resolution_clock::now() - start).count();
+        total += elapsed;
+        if (elapsed > worst) worst = elapsed;
+        if (paths.size() != 10) valid = false;
+        for (size_t i = 1; i < costs.size(); i++) {
+            if (costs[i] < costs[i - 1]) valid = false;
+        }
+    }
+    
+    cout << "  " << graph.getNumRoutes() << " routes: " << fixed << setprecision(3)
+         << total / queries << " ms/query on average, " << worst << " ms worst" << endl;
+    recordTest("K Shortest Paths k=10", valid, total / queries);
+}
+
+// Kruskal, Prim and Boruvka on networks of increasing density
+void benchmarkMST() {
+    int cores = ThreadPool::hardwareThreads();
+    cout << "\n=== Minimum Spanning Tree Benchmark by Density (" << cores << " cores) ===" << endl;
+    
+    int stations = 20000;
+    int degrees[4] = {4, 16, 64, 128};  // Average routes per station
+    bool same = true;
+    double largestTime = 0.0;
+    for (int d = 0; d < 4; d++) {
+        Graph graph(stations);
+        silenceOutput();
+        for (int i = 0; i < stations; i++) graph.addStation(i, "M" + to_string(i));
+        unsigned int seed = 99 + d;
+        for (int i = 1; i < stations; i++) {
+            seed = seed * 1103515245 + 12345;
+            graph.addRoute((seed >> 8) % i, i, 1 + (seed >> 12) % 1000);  // Random spanning tree: connected
+        }
+        for (long long r = 0; r < (long long)stations * degrees[d] / 2; r++) {
+            seed = seed * 1103515245 + 12345;
+            int u = (seed >> 8) % stations;
+            seed = seed * 1103515245 + 12345;
+            int v = (seed >> 8) % stations;
+            seed = seed * 1103515245 + 12345;
+            if (u != v) graph.addRoute(u < v ? u : v, u < v ? v : u, 1 + (seed >> 8) % 1000);
+        }
+        restoreOutput();
+        
+        auto start = high_resolution_clock::now();
+        vector<pair<pair<int, int>, int>> kruskal = graph.minimumSpanningTree();
+        double kruskalTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+        start = high_resolution_clock::now();
+        vector<pair<pair<int, int>, int>> prim = graph.minimumSpanningTreePrim();
+        double primTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+        start = high_resolution_clock::now();
+        vector<pair<pair<int, int>, int>> boruvka = graph.minimumSpanningTreeBoruvka(cores);
+        double boruvkaTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+        
+        long long total = 0, primTotal = 0, boruvkaTotal = 0;
+        for (size_t i = 0; i < kruskal.size(); i++) total += kruskal[i].second;
+        for (size_t i = 0; i < prim.size(); i++) primTotal += prim[i].second;
+        for (size_t i = 0; i < boruvka.size(); i++) boruvkaTotal += boruvka[i].second;
+        if (kruskal.size() != (size_t)stations - 1 || primTotal != total || boruvkaTotal != total) same = false;
+        
+        const char* best = "Kruskal";
+        double bestTime = kruskalTime;
+        if (primTime < bestTime) { best = "Prim"; bestTime = primTime; }
+        if (boruvkaTime < bestTime) { best = "Boruvka"; bestTime = boruvkaTime; }
+        cout << "  " << graph.getNumRoutes() << " routes (avg degree " << degrees[d] << "): Kruskal " << fixed
+             << setprecision(2) << kruskalTime << " ms, Prim " << primTime << " ms, Boruvka "
+             << boruvkaTime << " ms -> " << best << endl;
+        largestTime = bestTime;
+    }
+    recordTest("MST by Density (1.3M routes)", same, largestTime);
+}
+
+// SCC, condensation and reachability index on random networks of growing size
+void benchmarkReachability() {
+    cout << "\n=== Strongly Connected Components Benchmark ===" << endl;
+    
+    bool valid = true;
+    double largestTime = 0.0;
+    for (int stations = 125000; stations <= 500000; stations *= 2) {
+        // ~6 one-way local routes per station (offsets -16..+63, mostly forward), so the network
+        // splits into many components plus a large core
+        Graph graph(stations);
+        silenceOutput();
+        for (int i = 0; i < stations; i++) graph.addStation(i, "N" + to_string(i));
+        unsigned int seed = 321;
+        for (int i = 0; i < stations; i++) {
+            for (int r = 0; r < 6; r++) {
+                seed = seed * 1103515245 + 12345;
+                int jump = (seed >> 8) % 80 - 16;
+                int v = i + jump;
+                if (v >= 0 && v < stations && v != i) graph.addRoute(i, v, 1 + (seed >> 24));
+            }
+        }
+        restoreOutput();
+        
+        vector<int> component;
+        auto start = high_resolution_clock::now();
+        int count = graph.stronglyConnectedComponents(component);
+        double sccTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+        start = high_resolution_clock::now();
+        CSRGraph dag = graph.condensation(component, count);
+        double dagTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+        if (dag.detectCycle()) valid = false;
+        
+        ReachabilityIndex index;
+        start = high_resolution_clock::now();
+        bool exact = index.build(graph);
+        double indexTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+        
+        int queries = 100000;
+        int reachable = 0;
+        start = high_resolution_clock::now();
+        for (int q = 0; q < queries; q++) {
+            seed = seed * 1103515245 + 12345;
+            int a = (seed >> 8) % stations;
+            seed = seed * 1103515245 + 12345;
+            if (index.canReach(a, (seed >> 8) % stations)) reachable++;
+        }
+        double queryTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+        if (index.getNumComponents() != count) valid = false;
+        
+        cout << "  " << stations << " stations, " << graph.getNumRoutes() << " routes: SCC " << fixed
+             << setprecision(2) << sccTime << " ms (" << setprecision(1)
+             << sccTime * 1e6 / (stations + graph.getNumRoutes()) << " ns per station+route), "
+             << count << " components" << endl;
+        cout << "    Condensation " << setprecision(2) << dagTime << " ms (" << dag.getNumEdges()
+             << " routes), index " << indexTime << " ms (" << (exact ? "closure, " : "DFS fallback, ")
+             << index.getMemoryUsage() / 1024 << " KB), " << setprecision(1)
+             << queryTime * 1e6 / queries << " ns/query, " << reachable << " reachable" << endl;
+        largestTime = sccTime;
+    }
+    recordTest("SCC 3M Routes", valid, largestTime);
+}
+
+// Exact and sampled betweenness centrality across thread counts
+void benchmarkBetweenness() {
+    int cores = ThreadPool::hardwareThreads();
+    cout << "\n=== Betweenness Centrality Benchmark (" << cores << " cores) ===" << endl;
+    
+    int side = 50;
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side);
+    restoreOutput();
+    
+    vector<double> exact;
+    double exactTime = 0.0;
+    for (int threads = 1; ; threads *= 2) {
+        if (threads > cores) threads = cores;
+        auto start = high_resolution_clock::now();
+        vector<double> result = graph.betweennessCentrality(0, threads);
+        double elapsed = duration<double, milli>(high_resolution_clock::now() - start).count();
+        if (threads == 1) {
+            exact.swap(result);
+            exactTime = elapsed;
+        }
+        cout << "  Exact, " << side * side << " stations, " << threads << " thread(s): " << fixed
+             << setprecision(1) << elapsed << " ms, speedup " << setprecision(2) << exactTime / elapsed << "x" << endl;
+        if (threads == cores) break;
+    }
+    
+    // Top-10 stations of the exact ranking, to see how soon sampling finds them
+    vector<int> top;
+    vector<bool> taken(exact.size(), false);
+    for (int k = 0; k < 10; k++) {
+        int best = -1;
+        for (size_t v = 0; v < exact.size(); v++) {
+            if (!taken[v] && (best == -1 || exact[v] > exact[best])) best = v;
+        }
+        taken[best] = true;
+        top.push_back(best);
+    }
+    
+    bool valid = true;
+    for (int samples = 32; samples <= 512; samples *= 4) {
+        auto start = high_resolution_clock::now();
+        vector<double> estimate = graph.betweennessCentrality(samples, cores);
+        double elapsed = duration<double, milli>(high_resolution_clock::now() - start).count();
+        
+        // How many of the exact top 10 are in the estimated top 20
+        vector<bool> estimatedTop(estimate.size(), false);
+        for (int k = 0; k < 20; k++) {
+            int best = -1;
+            for (size_t v = 0; v < estimate.size(); v++) {
+                if (!estimatedTop[v] && (best == -1 || estimate[v] > estimate[best])) best = v;
+            }
+            estimatedTop[best] = true;
+        }
+        int found = 0;
+        for (int k = 0; k < 10; k++) {
+            if (estimatedTop[top[k]]) found++;
+        }
+        if (samples == 512 && found < 5) valid = false;
+        cout << "  Sampled, " << samples << " sources: " << setprecision(1) << elapsed << " ms, "
+             << found << "/10 of the exact top stations in the estimated top 20" << endl;
+    }
+    
+    Graph large(317 * 317);
+    silenceOutput();
+    buildGridGraph(large, 317);
+    restoreOutput();
+    auto start = high_resolution_clock::now();
+    large.betweennessCentrality(64, cores);
+    double largeTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    cout << "  Sampled, 64 sources on " << large.getNumVertices() << " stations: " << largeTime << " ms" << endl;
+    recordTest("Betweenness 2500 Stations Exact", valid, exactTime);
+}
+
+// Startup: rebuilding through addStation/addRoute vs mapping the binary file
+void benchmarkGraphFile() {
+    cout << "\n=== Binary Graph File Benchmark (500x500 Grid) ===" << endl;
+    
+    int side = 500;
+    auto start = high_resolution_clock::now();
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side);
+    restoreOutput();
+    double rebuildTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    
+    start = high_resolution_clock::now();
+    bool ok = MappedGraph::write(graph, "bench_graph.bin");
+    double writeTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    
+    MappedGraph mapped;
+    start = high_resolution_clock::now();
+    ok = ok && mapped.open("bench_graph.bin");
+    int distance = 0;
+    mapped.shortestPath(0, side + 1, &distance);  // First query: touches only the pages it needs
+    double openTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    
+    start = high_resolution_clock::now();
+    ok = ok && mapped.verify();
+    double verifyTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    
+    int expected = 0;
+    graph.freeze().shortestPath(0, side + 1, &expected);
+    ok = ok && distance == expected;
+    
+    cout << "  " << graph.getNumRoutes() << " routes, file " << mapped.getFileBytes() / 1024 << " KB" << endl;
+    cout << "  Rebuild with addStation/addRoute: " << fixed << setprecision(2) << rebuildTime << " ms" << endl;
+    cout << "  Write: " << writeTime << " ms, open + first query: " << setprecision(3) << openTime
+         << " ms, full verify: " << setprecision(2) << verifyTime << " ms" << endl;
+    mapped.close();
+    remove("bench_graph.bin");
+    recordTest("Graph File Startup 1M Routes", ok, openTime,
+               "Speedup vs rebuild: " + to_string(rebuildTime / (openTime > 0 ? openTime : 1e-6)) + "x");
+}
+
+// Streaming CSV import vs getline/stringstream parsing with the per-record APIs
+void benchmarkBulkLoader() {
+    cout << "\n=== CSV Bulk Loader Benchmark ===" << endl;
+    
+    int numStations = 200000;
+    int numRoutes = 1000000;
+    int numVehicles = 50000;
+    int numPassengers = 500000;
+    FILE* file = fopen("bench_stations.csv", "wb");
+    if (file == nullptr) return;
+    fprintf(file, "id,name,x,y\n");
+    for (int i = 0; i < numStations; i++) {
+        fprintf(file, "%d,Station %d,%.4f,%.4f\n", i, i, (i % 1000) * 0.25, (i / 1000) * 0.25);
+    }
+    fclose(file);
+    file = fopen("bench_routes.csv", "wb");
+    if (file == nullptr) return;
+    unsigned int seed = 4242;
+    for (int r = 0; r < numRoutes; r++) {
+        seed = seed * 1103515245 + 12345;
+        int u = (seed >> 8) % numStations;
+        seed = seed * 1103515245 + 12345;
+        fprintf(file, "%d,%d,%d\n", u, (seed >> 8) % numStations, 1 + (int)(seed % 60));
+    }
+    fclose(file);
+    file = fopen("bench_vehicles.csv", "wb");
+    if (file == nullptr) return;
+    for (int i = 0; i < numVehicles; i++) {
+        fprintf(file, "%d,%s,Model %d,%d,%.1f\n", i, (i % 3 == 0) ? "Metro" : "Bus", i % 40, 40 + i % 160, 30.0 + i % 70);
+    }
+    fclose(file);
+    file = fopen("bench_passengers.csv", "wb");
+    if (file == nullptr) return;
+    for (int i = 0; i < numPassengers; i++) {
+        fprintf(file, "%d,Passenger %d,%d,%d\n", i, i, i % numStations, (i * 7) % numStations);
+    }
+    fclose(file);
+    
+    BulkLoader loader;
+    LoadStats stationStats, routeStats, vehicleStats, passengerStats;
+    Graph graph(0);
+    HashTable vehicles;
+    Queue passengers;
+    bool ok = loader.loadStations("bench_stations.csv", graph, &stationStats) &&
+              loader.loadRoutes("bench_routes.csv", graph, &routeStats) &&
+              loader.loadVehicles("bench_vehicles.csv", vehicles, &vehicleStats) &&
+              loader.loadPassengers("bench_passengers.csv", passengers, &passengerStats);
+    ok = ok && graph.getAllStations().size() == (size_t)numStations && routeStats.records == numRoutes &&
+         vehicles.getNumVehicles() == numVehicles && passengers.getSize() == numPassengers;
+    cout << "  ";
+    BulkLoader::printStats("stations", stationStats);
+    cout << "  ";
+    BulkLoader::printStats("routes", routeStats);
+    cout << "  ";
+    BulkLoader::printStats("vehicles", vehicleStats);
+    cout << "  ";
+    BulkLoader::printStats("passengers", passengerStats);
+    
+    // Baseline: the route file through ifstream/getline/stringstream and addRoute
+    Graph baseline(numStations);
+    silenceOutput();
+    for (int i = 0; i < numStations; i++) baseline.addStation(i, "Station " + to_string(i));
+    auto start = high_resolution_clock::now();
+    ifstream in("bench_routes.csv");
+    string line;
+    long long baselineRecords = 0;
+    while (getline(in, line)) {
+        stringstream fields(line);
+        string a, b, c;
+        getline(fields, a, ',');
+        getline(fields, b, ',');
+        getline(fields, c, ',');
+        baseline.addRoute(stoi(a), stoi(b), stoi(c));
+        baselineRecords++;
+    }
+    in.close();
+    double baselineTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    restoreOutput();
+    ok = ok && baseline.getNumRoutes() == graph.getNumRoutes();
+    for (int v = 0; v < numStations && ok; v += 997) {
+        if (baseline.getRouteWeight(v, (v * 7) % numStations) != graph.getRouteWeight(v, (v * 7) % numStations)) ok = false;
+    }
+    
+    double rate = routeStats.recordsPerSecond();
+    double baselineRate = baselineRecords * 1000.0 / (baselineTime > 0 ? baselineTime : 1e-6);
+    cout << "  Baseline routes (getline + stringstream + addRoute): " << fixed << setprecision(2)
+         << baselineTime << " ms (" << (long long)baselineRate << " records/sec)" << endl;
+    cout << "  Speedup: " << rate / (baselineRate > 0 ? baselineRate : 1e-6) << "x" << endl;
+    
+    remove("bench_stations.csv");
+    remove("bench_routes.csv");
+    remove("bench_vehicles.csv");
+    remove("bench_passengers.csv");
+    recordTest("CSV Bulk Load 1M Routes", ok, routeStats.elapsedMs,
+               to_string((long long)rate) + " records/sec");
+}
+
+// Cost of the per-operation messages: flushed per line, buffered, and switched off
+void benchmarkLogging() {
+    cout << "\n=== Logging Overhead Benchmark (200k Route Inserts) ===" << endl;
+    
+    int numStations = 20000;
+    int numRoutes = 200000;
+    double times[3] = {0.0, 0.0, 0.0};
+    const char* names[3] = {"Flush per message (endl)", "Buffered file sink", "Level OFF"};
+    bool ok = true;
+    for (int mode = 0; mode < 3; mode++) {
+        FILE* target = fopen("bench_log.txt", "wb");
+        if (target == nullptr) return;
+        FlushingSink flushing(target);
+        FileSink buffered;
+        if (mode == 0) Logger::setSink(&flushing);
+        if (mode == 1) {
+            fclose(target);
+            target = nullptr;
+            buffered.open("bench_log.txt");
+            Logger::setSink(&buffered);
+        }
+        if (mode == 2) Logger::setLevel(LOG_LEVEL_OFF);
+        
+        Graph graph(numStations);
+        for (int i = 0; i < numStations; i++) graph.addStation(i, "S");
+        unsigned int seed = 31;
+        auto start = high_resolution_clock::now();
+        for (int r = 0; r < numRoutes; r++) {
+            seed = seed * 1103515245 + 12345;
+            graph.addRoute(r % numStations, (seed >> 8) % numStations, 1 + r % 9);
+        }
+        Logger::flush();
+        times[mode] = duration<double, milli>(high_resolution_clock::now() - start).count();
+        
+        Logger::setSink(nullptr);
+        Logger::setLevel(LOG_LEVEL_INFO);
+        if (target != nullptr) fclose(target);
+        if (graph.getNumRoutes() == 0) ok = false;
+        remove("bench_log.txt");
+    }
+    
+    for (int mode = 0; mode < 3; mode++) {
+        cout << "  " << names[mode] << ": " << fixed << setprecision(2) << times[mode] << " ms ("
+             << setprecision(2) << times[0] / (times[mode] > 0 ? times[mode] : 1e-6) << "x)" << endl;
+    }
+    recordTest("Logging Overhead", ok, times[2],
+               "Buffered " + to_string(times[0] / (times[1] > 0 ? times[1] : 1e-6)) + "x, off " +
+               to_string(times[0] / (times[2] > 0 ? times[2] : 1e-6)) + "x vs flush per message");
+}
+
+// Open addressing vs the fixed 101-bucket chained table
+void benchmarkHashTable() {
+    cout << "\n=== Vehicle Hash Table Benchmark ===" << endl;
+    
+    Logger::setLevel(LOG_LEVEL_OFF);
+    int sizes[2] = {50000, 2000000};
+    bool ok = true;
+    double speedup = 0.0;
+    for (int run = 0; run < 2; run++) {
+        int n = sizes[run];
+        vector<int> ids(n);
+        unsigned int seed = 17;
+        for (int i = 0; i < n; i++) {
+            seed = seed * 1103515245 + 12345;
+            ids[i] = (int)((seed >> 4) & 0x3FFFFFF) * 2;  // Even IDs; odd ones are misses
+        }
+        
+        double times[2][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+        for (int table = 0; table < 2; table++) {
+            if (table == 0 && n > 50000) continue;  // Chained: about n^2 / 200 node visits
+            ChainedHashTable chained;
+            HashTable open;
+            auto start = high_resolution_clock::now();
+            for (int i = 0; i < n; i++) {
+                Vehicle vehicle(ids[i], "Bus", "City", 50, 60.0);
+                if (table == 0) chained.insert(vehicle);
+                else open.insert(vehicle);
+            }
+            times[table][0] = duration<double, milli>(high_resolution_clock::now() - start).count();
+            
+            long long found = 0;
+            start = high_resolution_clock::now();
+            for (int i = 0; i < n; i++) {
+                if ((table == 0 ? chained.search(ids[i]) : open.search(ids[i])) != nullptr) found++;
+            }
+            times[table][1] = duration<double, milli>(high_resolution_clock::now() - start).count();
+            
+            start = high_resolution_clock::now();
+            for (int i = 0; i < n; i++) {
+                if ((table == 0 ? chained.search(ids[i] + 1) : open.search(ids[i] + 1)) != nullptr) found++;
+            }
+            times[table][2] = duration<double, milli>(high_resolution_clock::now() - start).count();
+            if (found != n) ok = false;
+            if (table == 1) {
+                cout << "  " << n << " vehicles, open addressing: capacity " << open.getCapacity()
+                     << ", load " << fixed << setprecision(3) << open.getLoadFactor()
+                     << ", longest probe " << open.getLongestProbe() << " group(s)" << endl;
+            } else {
+                cout << "  " << n << " vehicles, chained: longest chain " << chained.getLongestChain() << endl;
+            }
+        }
+        
+        const char* names[2] = {"Chained (101 buckets)", "Open addressing"};
+        for (int table = 0; table < 2; table++) {
+            if (table == 0 && n > 50000) continue;
+            cout << "    " << names[table] << ": insert " << fixed << setprecision(2) << times[table][0]
+                 << " ms, hit lookups " << times[table][1] << " ms, miss lookups " << times[table][2]
+                 << " ms (" << setprecision(1) << (times[table][1] * 1e6 / n) << " ns/hit)" << endl;
+        }
+        if (run == 0) speedup = times[0][1] / (times[1][1] > 0 ? times[1][1] : 1e-6);
+    }
+    Logger::setLevel(LOG_LEVEL_INFO);
+    cout << "  Lookup speedup at 50k vehicles: " << setprecision(1) << speedup << "x" << endl;
+    recordTest("Vehicle Hash Table 50k Lookups", ok, 0.0, "Speedup " + to_string(speedup) + "x");
+}
+
+// "All Metros with capacity >= 350" and similar questions: secondary indexes
+// vs a scan over every stored vehicle
+void benchmarkVehicleIndexes() {
+    cout << "\n=== Vehicle Secondary Index Benchmark (500k Vehicles) ===" << endl;
+    
+    int n = 500000;
+    const char* types[5] = {"Bus", "Metro", "Train", "Tram", "Ferry"};
+    vector<Vehicle> batch;
+    unsigned int seed = 41;
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245 + 12345;
+        batch.push_back(Vehicle(i, types[(seed >> 8) % 5], "Fleet", 20 + (seed >> 12) % 381, 20 + (seed >> 20) % 101));
+    }
+    HashTable vehicles;
+    auto start = high_resolution_clock::now();
+    vehicles.insertBatch(batch);
+    double loadTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    cout << "  Indexed load: " << fixed << setprecision(2) << loadTime << " ms ("
+         << setprecision(0) << n / loadTime * 1000.0 << " vehicles/sec)" << endl;
+    
+    VehicleFilter filters[3];
+    const char* names[3] = {"Metro, capacity >= 350", "Speed 118-120 km/h", "Ferry, capacity 100-110, speed >= 100"};
+    filters[0].type = "Metro";
+    filters[0].minCapacity = 350;
+    filters[1].minSpeed = 118.0;
+    filters[1].maxSpeed = 120.0;
+    filters[2].type = "Ferry";
+    filters[2].minCapacity = 100;
+    filters[2].maxCapacity = 110;
+    filters[2].minSpeed = 100.0;
+    
+    bool same = true;
+    double firstSpeedup = 0.0;
+    int rounds = 20;
+    for (int q = 0; q < 3; q++) {
+        const VehicleFilter& filter = filters[q];
+        vector<int> indexed;
+        start = high_resolution_clock::now();
+        for (int r = 0; r < rounds; r++) indexed = vehicles.findVehicles(filter);
+        double indexTime = duration<double, milli>(high_resolution_clock::now() - start).count() / rounds;
+        
+        vector<int> scanned;
+        start = high_resolution_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            scanned.clear();
+            const vector<Vehicle>& all = vehicles.getAllVehicles();
+            for (size_t i = 0; i < all.size(); i++) {
+                const Vehicle& v = all[i];
+                if ((filter.type.empty() || v.type == filter.type) && v.capacity >= filter.minCapacity &&
+                    v.capacity <= filter.maxCapacity && v.speed >= filter.minSpeed && v.speed <= filter.maxSpeed) {
+                    scanned.push_back(v.id);
+                }
+            }
+        }
+        double scanTime = duration<double, milli>(high_resolution_clock::now() - start).count() / rounds;
+        if (indexed.size() != scanned.size()) same = false;
+        double speedup = scanTime / (indexTime > 0 ? indexTime : 1e-6);
+        if (q == 0) firstSpeedup = speedup;
+        cout << "  " << names[q] << ": " << indexed.size() << " vehicles, index " << setprecision(3)
+             << indexTime << " ms, full scan " << scanTime << " ms (" << setprecision(1) << speedup << "x)" << endl;
+    }
+    
+    // Telemetry updates move entries between index positions
+    start = high_resolution_clock::now();
+    for (int i = 0; i < 200000; i++) {
+        seed = seed * 1103515245 + 12345;
+        vehicles.updateTelemetry((seed >> 8) % n, 20 + (seed >> 12) % 381, 20 + (seed >> 20) % 101);
+    }
+    double updateTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    cout << "  200k telemetry updates: " << setprecision(2) << updateTime << " ms ("
+         << setprecision(0) << updateTime * 1e6 / 200000 << " ns each)" << endl;
+    recordTest("Vehicle Index Filter Queries", same, 0.0,
+               "Metro query " + to_string(firstSpeedup) + "x faster than a scan");
+}
+
+// Mixed dispatch/telemetry load (90% reads, 10% speed/capacity updates) on the
+// sharded registry and on one HashTable behind a single mutex
+void benchmarkVehicleRegistry() {
+    int cores = ThreadPool::hardwareThreads();
+    cout << "\n=== Concurrent Vehicle Registry Benchmark (" << cores << " cores) ===" << endl;
+    
+    int numVehicles = 200000;
+    int totalOps = 4000000;
+    Logger::setLevel(LOG_LEVEL_OFF);
+    VehicleRegistry registry;
+    HashTable locked;
+    mutex tableMutex;
+    for (int i = 0; i < numVehicles; i++) {
+        Vehicle vehicle(i, "Bus", "City", 50, 60.0);
+        registry.insert(vehicle);
+        locked.insert(vehicle);
+    }
+    Logger::setLevel(LOG_LEVEL_INFO);
+    
+    int maxThreads = cores > 4 ? cores : 4;
+    double registryBase = 0.0;
+    double lockedBase = 0.0;
+    double registryBest = 0.0;
+    bool ok = true;
+    for (int threads = 1; ; threads *= 2) {
+        if (threads > maxThreads) threads = maxThreads;
+        ThreadPool pool(threads);
+        double rate[2] = {0.0, 0.0};
+        for (int variant = 0; variant < 2; variant++) {
+            atomic<long long> hits(0);
+            auto start = high_resolution_clock::now();
+            pool.parallelFor(threads, [&](int task, int) {
+                unsigned int seed = 31 + task;
+                long long found = 0;
+                int ops = totalOps / threads;
+                for (int op = 0; op < ops; op++) {
+                    seed = seed * 1103515245 + 12345;
+                    int id = (seed >> 8) % numVehicles;
+                    bool update = (seed >> 28) < 2;  // 2 in 16, roughly 10%
+                    int capacity = 0;
+                    double speed = 0.0;
+                    if (variant == 0) {
+                        if (update) registry.updateTelemetry(id, op % 100, op % 120);
+                        else if (registry.getTelemetry(id, capacity, speed)) found++;
+                    } else {
+                        lock_guard<mutex> lock(tableMutex);
+                        if (update) locked.updateTelemetry(id, op % 100, op % 120);
+                        else if (locked.search(id) != nullptr) found++;
+                    }
+                }
+                hits += found;
+            });
+            double elapsed = duration<double, milli>(high_resolution_clock::now() - start).count();
+            rate[variant] = (totalOps / threads) * (double)threads / (elapsed > 0 ? elapsed : 1e-6) / 1000.0;
+            if (hits.load() == 0) ok = false;
+        }
+        if (threads == 1) {
+            registryBase = rate[0];
+            lockedBase = rate[1];
+        }
+        if (rate[0] > registryBest) registryBest = rate[0];
+        cout << "  " << threads << " thread(s): sharded " << fixed << setprecision(2) << rate[0]
+             << " Mops/s (" << rate[0] / registryBase << "x), global mutex " << rate[1]
+             << " Mops/s (" << rate[1] / lockedBase << "x)" << endl;
+        if (threads == maxThreads) break;
+    }
+    if (cores == 1) cout << "  Single core: thread counts above 1 share it, so no scaling is possible here" << endl;
+    ok = ok && registry.getNumVehicles() == numVehicles;
+    recordTest("Vehicle Registry Mixed Load", ok, 0.0,
+               "Best " + to_string(registryBest) + " Mops/s, " + to_string(registry.getNumShards()) + " shards");
+}
+
+// Direction-optimizing parallel BFS vs the queue-based BFS
+void benchmarkParallelBFS() {
+    int cores = ThreadPool::hardwareThreads();
+    cout << "\n=== Direction-Optimizing BFS Benchmark (" << cores << " cores) ===" << endl;
+    
+    // Low-degree road grid and a dense random network (200k stations, ~16 routes each)
+    int side = 317;
+    Graph grid(side * side);
+    int denseStations = 200000;
+    Graph dense(denseStations);
+    silenceOutput();
+    buildGridGraph(grid, side);
+    for (int i = 0; i < denseStations; i++) dense.addStation(i, "N" + to_string(i));
+    unsigned int seed = 77;
+    for (int r = 0; r < denseStations * 16; r++) {
+        seed = seed * 1103515245 + 12345;
+        int u = (seed >> 8) % denseStations;
+        seed = seed * 1103515245 + 12345;
+        int v = (seed >> 8) % denseStations;
+        if (u != v) dense.addRoute(u, v, 1);
+    }
+    restoreOutput();
+    
+    Graph* networks[2] = {&grid, &dense};
+    const char* names[2] = {"Grid", "Dense"};
+    bool same = true;
+    double denseTime = 0.0;
+    for (int n = 0; n < 2; n++) {
+        Graph& graph = *networks[n];
+        int rounds = 5;
+        double queueTime = 0.0;
+        vector<int> reference;
+        for (int q = 0; q < rounds; q++) {
+            auto start = high_resolution_clock::now();
+            reference = graph.BFS(q * 7919 % graph.getNumVertices());
+            queueTime += duration<double, milli>(high_resolution_clock::now() - start).count();
+        }
+        cout << "  " << names[n] << " (" << graph.getNumRoutes() << " routes), queue BFS: " << fixed
+             << setprecision(3) << queueTime / rounds << " ms" << endl;
+        
+        for (int threads = 1; ; threads *= 2) {
+            if (threads > cores) threads = cores;
+            double elapsed = 0.0;
+            int bottomUp = 0;
+            for (int q = 0; q < rounds; q++) {
+                auto start = high_resolution_clock::now();
+                vector<int> order = graph.parallelBFS(q * 7919 % graph.getNumVertices(), nullptr, threads, &bottomUp);
+                elapsed += duration<double, milli>(high_resolution_clock::now() - start).count();
+                if (q == rounds - 1 && order.size() != reference.size()) same = false;
+            }
+            cout << "    " << threads << " thread(s): " << elapsed / rounds << " ms ("
+                 << bottomUp << " bottom-up levels), speedup " << setprecision(2)
+                 << queueTime / elapsed << "x" << setprecision(3) << endl;
+            if (n == 1 && threads == 1) denseTime = elapsed / rounds;
+            if (threads == cores) break;
+        }
+    }
+    recordTest("Parallel BFS Reachability", same, denseTime);
+}
+
+// Repeated DFS and cycle checks reusing the generation-stamped workspace
+void benchmarkTraversal() {
+    cout << "\n=== Repeated Traversal Benchmark (317x317 Grid) ===" << endl;
+    
+    int side = 317;
+    int rounds = 50;
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side);
+    // Acyclic version (routes only go right and down) so every cycle check scans the whole network
+    Graph dag(side * side);
+    for (int i = 0; i < side * side; i++) dag.addStation(i, "DAG " + to_string(i));
+    for (int i = 0; i < side * side; i++) {
+        if (i % side + 1 < side) dag.addRoute(i, i + 1, 1);
+        if (i + side < side * side) dag.addRoute(i, i + side, 1);
+    }
+    restoreOutput();
+    CSRGraph csr = graph.freeze();
+    
+    bool same = true;
+    double dfsTime = 0.0, cycleTime = 0.0, csrTime = 0.0;
+    for (int q = 0; q < rounds; q++) {
+        int src = (q * 7919) % (side * side);
+        auto start = high_resolution_clock::now();
+        vector<int> order = graph.DFS(src);
+        dfsTime += duration<double, milli>(high_resolution_clock::now() - start).count();
+        
+        start = high_resolution_clock::now();
+        if (dag.detectCycle()) same = false;
+        cycleTime += duration<double, milli>(high_resolution_clock::now() - start).count();
+        
+        start = high_resolution_clock::now();
+        vector<int> csrOrder = csr.DFS(src);
+        csrTime += duration<double, milli>(high_resolution_clock::now() - start).count();
+        if (order != csrOrder || (int)order.size() != side * side) same = false;
+    }
+    
+    double edgesPerSecond = (double)graph.getNumRoutes() * rounds / (dfsTime / 1000.0);
+    cout << "  DFS (reused workspace): " << fixed << setprecision(3) << dfsTime / rounds << " ms/traversal, "
+         << setprecision(1) << edgesPerSecond / 1e6 << "M routes/s" << endl;
+    cout << "  Cycle check:            " << setprecision(3) << cycleTime / rounds << " ms/check" << endl;
+    cout << "  CSR DFS (fresh arrays): " << csrTime / rounds << " ms/traversal" << endl;
+    recordTest("Repeated DFS 100k Stations", same, dfsTime / rounds);
+}
+
+// Hub tree repair after single route changes vs recomputing every hub from scratch
+void benchmarkDynamicSSSP() {
+    cout << "\n=== Dynamic Hub Trees Benchmark (317x317 Grid, 4 Hubs) ===" << endl;
+    
+    int side = 317;
+    int updates = 1000;
+    Graph graph(side * side);
+    silenceOutput();
+    buildGridGraph(graph, side);
+    restoreOutput();
+    
+    vector<int> hubs, probes;
+    hubs.push_back(0);
+    hubs.push_back(side * side - 1);
+    hubs.push_back(side / 2 * side + side / 2);
+    hubs.push_back(side - 1);
+    for (int i = 0; i < 4; i++) graph.addHub(hubs[i]);
+    
+    unsigned int seed = 2024;
+    double repairTotal = 0.0;
+    long long relabelled = 0;
+    silenceOutput();
+    for (int i = 0; i < updates; i++) {
+        seed = seed * 1103515245 + 12345;
+        int u = (seed >> 8) % (side * side);
+        int v = (u % side + 1 < side) ? u + 1 : u - 1;
+        seed = seed * 1103515245 + 12345;
+        int weight = 1 + (seed >> 8) % 40;
+        auto start = high_resolution_clock::now();
+        graph.addRoute(u, v, weight);
+        repairTotal += duration<double, milli>(high_resolution_clock::now() - start).count();
+        relabelled += graph.getLastRepairCount();
+    }
+    restoreOutput();
+    
+    for (int i = 0; i < 200; i++) {
+        seed = seed * 1103515245 + 12345;
+        probes.push_back((seed >> 8) % (side * side));
+    }
+    auto start = high_resolution_clock::now();
+    vector<int> expected = graph.distanceMatrix(hubs, probes, 1);
+    double recomputeTime = duration<double, milli>(high_resolution_clock::now() - start).count();
+    bool exact = true;
+    for (int h = 0; h < 4; h++) {
+        for (size_t t = 0; t < probes.size(); t++) {
+            if (graph.hubDistance(hubs[h], probes[t]) != expected[h * probes.size() + t]) exact = false;
+        }
+    }
+    
+    cout << "  Repair: " << fixed << setprecision(4) << repairTotal / updates << " ms/update, "
+         << setprecision(1) << (double)relabelled / updates << " labels recomputed on average" << endl;
+    cout << "  Full recompute of 4 hubs: " << setprecision(3) << recomputeTime << " ms ("
+         << setprecision(0) << recomputeTime / (repairTotal / updates) << "x slower)" << endl;
+    recordTest("Dynamic Hub Trees 1000 Updates", exact, repairTotal / updates);
+}
+
+// Contraction Hierarchies: preprocessing cost and query latency vs Dijkstra
+void benchmarkContractionHierarchy() {
+    cout << "\n=== Contraction Hierarchies Benchmark ===" << endl;
+    
+    vector<int> sides = {50, 100};
+    for (int side : sides) {
+        Graph graph(side * side);
+        silenceOutput();
+        buildGridGraph(graph, side, 10, 14);
+        restoreOutput();
+        CSRGraph csr = graph.freeze();
+        
+        ContractionHierarchy ch;
+        auto start = high_resolution_clock::now();
+        ch.build(graph);
+        auto end = high_resolution_clock::now();
+        double buildTime = duration<double, milli>(end - start).count();
+        
+        int queries = 1000;
+        vector<int> sources(queries), targets(queries);
+        unsigned int seed = 99;
+        for (int q = 0; q < queries; q++) {
+            seed = seed * 1103515245 + 12345;
+            sources[q] = (seed >> 8) % (side * side);
+            seed = seed * 1103515245 + 12345;
+            targets[q] = (seed >> 8) % (side * side);
+        }
+        
+        start = high_resolution_clock::now();
+        long long chSum = 0;
+        for (int q = 0; q < queries; q++) {
+            chSum += ch.distance(sources[q], targets[q]);
+        }
+        end = high_resolution_clock::now();
+        double chTime = duration<double, milli>(end - start).count();
+        
+        int dijkstraQueries = 50;
+        long long dijkstraSum = 0, chCheck = 0;
+        start = high_resolution_clock::now();
+        for (int q = 0; q < dijkstraQueries; q++) {
+            int d;
+            csr.shortestPath(sources[q], targets[q], &d);
+            dijkstraSum += d;
+        }
+        end = high_resolution_clock::now();
+        double dijkstraTime = duration<double, milli>(end - start).count();
+        for (int q = 0; q < dijkstraQueries; q++) {
+            chCheck += ch.distance(sources[q], targets[q]);
+        }
+        
+        cout << "\n" << side * side << " stations:" << endl;
+        cout << "  Preprocessing: " << fixed << setprecision(3) << buildTime << " ms, "
+             << ch.getNumShortcuts() << " shortcuts" << endl;
+        cout << "  CH query:       " << chTime / queries << " ms/query ("
+             << (int)(queries / (chTime / 1000.0)) << " QPS)" << endl;
+        cout << "  Dijkstra query: " << dijkstraTime / dijkstraQueries << " ms/query" << endl;
+        recordTest("CH Query " + to_string(side * side), chSum > 0 && chCheck == dijkstraSum,
+                   chTime / queries);
+    }
+}
+
 // ==================== ANALYTICS TESTS ====================
 
 void testAnalytics() {
@@ -481,6 +3430,92 @@ void testAnalytics() {
     end = high_resolution_clock::now();
     time = duration<double, milli>(end - start).count();
     recordTest("Daily Usage Trends", true, time);
+    
+    // Betweenness vs a brute-force count over all-pairs distances and path counts
+    bool centralityMatch = true;
+    unsigned int seed = 11;
+    for (int trial = 0; trial < 8 && centralityMatch; trial++) {
+        int n = 25;
+        Graph network(n);
+        silenceOutput();
+        for (int i = 0; i < n; i++) network.addStation(i, "B" + to_string(i));
+        for (int r = 0; r < 70; r++) {
+            seed = seed * 1103515245 + 12345;
+            int u = (seed >> 8) % n;
+            seed = seed * 1103515245 + 12345;
+            int v = (seed >> 8) % n;
+            if (u != v) network.addRoute(u, v, 1 + (seed >> 20) % 3);  // Small weights: many ties
+        }
+        restoreOutput();
+        
+        // Floyd-Warshall distances, then path counts in order of distance
+        vector<vector<long long>> dist(n, vector<long long>(n, LLONG_MAX / 4));
+        for (int u = 0; u < n; u++) {
+            dist[u][u] = 0;
+            for (int v = 0; v < n; v++) {
+                if (network.getRouteWeight(u, v) > 0) dist[u][v] = network.getRouteWeight(u, v);
+            }
+        }
+        for (int k = 0; k < n; k++)
+            for (int i = 0; i < n; i++)
+                for (int j = 0; j < n; j++)
+                    if (dist[i][k] + dist[k][j] < dist[i][j]) dist[i][j] = dist[i][k] + dist[k][j];
+        vector<vector<double>> paths(n, vector<double>(n, 0.0));
+        for (int s = 0; s < n; s++) {
+            paths[s][s] = 1.0;
+            for (long long d = 1; d <= 3 * n; d++) {
+                for (int t = 0; t < n; t++) {
+                    if (dist[s][t] != d) continue;
+                    for (int u = 0; u < n; u++) {
+                        int w = network.getRouteWeight(u, t);
+                        if (w > 0 && dist[s][u] + w == d) paths[s][t] += paths[s][u];
+                    }
+                }
+            }
+        }
+        vector<double> expected(n, 0.0);
+        for (int s = 0; s < n; s++)
+            for (int t = 0; t < n; t++)
+                for (int v = 0; v < n; v++)
+                    if (v != s && v != t && s != t && paths[s][t] > 0 && dist[s][v] + dist[v][t] == dist[s][t])
+                        expected[v] += paths[s][v] * paths[v][t] / paths[s][t];
+        
+        vector<double> serial = network.betweennessCentrality(0, 1);
+        vector<double> parallel = network.betweennessCentrality(0, 3);
+        vector<double> allSampled = network.betweennessCentrality(n, 2);  // Every source: exact
+        for (int v = 0; v < n; v++) {
+            if (fabs(serial[v] - expected[v]) > 1e-6 || fabs(parallel[v] - expected[v]) > 1e-6 ||
+                fabs(allSampled[v] - expected[v]) > 1e-6) centralityMatch = false;
+        }
+    }
+    
+    // Sampling on the 20x20 grid: unbiased estimate, so the total stays close to the exact one
+    Graph grid(400);
+    silenceOutput();
+    buildGridGraph(grid, 20);
+    restoreOutput();
+    start = high_resolution_clock::now();
+    vector<double> exact = grid.betweennessCentrality();
+    end = high_resolution_clock::now();
+    vector<double> sampled = grid.betweennessCentrality(100);
+    double exactTotal = 0.0, sampledTotal = 0.0;
+    for (int v = 0; v < 400; v++) {
+        exactTotal += exact[v];
+        sampledTotal += sampled[v];
+    }
+    centralityMatch = centralityMatch && fabs(sampledTotal - exactTotal) < 0.1 * exactTotal &&
+                      grid.betweennessCentrality(100) == sampled;  // Same seed, same sources
+    recordTest("Betweenness Centrality (Brandes)", centralityMatch, duration<double, milli>(end - start).count());
+    
+    silenceOutput();
+    analytics.criticalStations();
+    restoreOutput();
+    Analytics gridAnalytics(&grid, &vehicleDB, &routeMetadata, &vehicleHeap);
+    ostringstream report;
+    gridAnalytics.criticalStations(report, 50);
+    bool reported = report.str().find("(Estimated from 50 sampled source stations)") != string::npos &&
+                    report.str().find("Top Critical Stations:") != string::npos;
+    recordTest("Critical Stations Report", reported, 0.0);
 }
 
 // ==================== MAIN TEST RUNNER ====================
@@ -528,9 +3563,16 @@ int main() {
     
     // Run all tests
     testGraphOperations();
+    testContractionHierarchy();
+    testTimetable();
+    testReachability();
+    testGraphFile();
+    testBulkLoader();
+    testLogger();
     testQueueOperations();
     testStackOperations();
     testHashTableOperations();
+    testVehicleRegistry();
     testBSTOperations();
     testHeapOperations();
     testSearchingAlgorithms();
@@ -539,6 +3581,29 @@ int main() {
     
     // Performance tests
     performanceTest();
+    benchmarkShortestPath();
+    benchmarkCSRGraph();
+    benchmarkRouteLoading();
+    benchmarkAStar();
+    benchmarkBidirectional();
+    benchmarkLandmarks();
+    benchmarkDistanceMatrix();
+    benchmarkTimeDependent();
+    benchmarkTimetable();
+    benchmarkKShortestPaths();
+    benchmarkTraversal();
+    benchmarkParallelBFS();
+    benchmarkMST();
+    benchmarkReachability();
+    benchmarkBetweenness();
+    benchmarkGraphFile();
+    benchmarkBulkLoader();
+    benchmarkLogging();
+    benchmarkHashTable();
+    benchmarkVehicleIndexes();
+    benchmarkVehicleRegistry();
+    benchmarkDynamicSSSP();
+    benchmarkContractionHierarchy();
     
     // Print summary
     printSummary();
@@ -0,0 +1,85 @@
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(int numThreads)
+    : body(nullptr), nextTask(0), taskCount(0), generation(0), busyWorkers(0), stopping(false) {
+    if (numThreads <= 0) numThreads = hardwareThreads();
+    for (int i = 1; i < numThreads; i++) {
+        workers.push_back(thread(&ThreadPool::workerLoop, this, i));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (size_t i = 0; i < workers.size(); i++) {
+        workers[i].join();
+    }
+}
+
+int ThreadPool::hardwareThreads() {
+    unsigned int cores = thread::hardware_concurrency();
+    return cores == 0 ? 1 : (int)cores;
+}
+
+// Claims indices until the job runs out - Time: O(tasks claimed)
+void ThreadPool::runTasks(const function<void(int, int)>& job, int worker) {
+    while (true) {
+        int index = nextTask.fetch_add(1);
+        if (index >= taskCount) return;
+        job(index, worker);
+    }
+}
+
+void ThreadPool::workerLoop(int worker) {
+    int seen = 0;
+    while (true) {
+        const function<void(int, int)>* job;
+        {
+            unique_lock<mutex> guard(lock);
+            while (!stopping && generation == seen) {
+                wake.wait(guard);
+            }
+            if (stopping) return;
+            seen = generation;
+            job = body;
+        }
+        
+        runTasks(*job, worker);
+        
+        lock_guard<mutex> guard(lock);
+        busyWorkers--;
+        if (busyWorkers == 0) finished.notify_one();
+    }
+}
+
+// Parallel For - Time: O(count / threads) per thread plus one wake-up, Space: O(1)
+void ThreadPool::parallelFor(int count, const function<void(int, int)>& job) {
+    if (count <= 0) return;
+    if (workers.empty()) {
+        for (int i = 0; i < count; i++) {
+            job(i, 0);
+        }
+        return;
+    }
+    
+    {
+        lock_guard<mutex> guard(lock);
+        body = &job;
+        taskCount = count;
+        nextTask = 0;
+        busyWorkers = workers.size();
+        generation++;
+    }
+    wake.notify_all();
+    
+    runTasks(job, 0);
+    
+    unique_lock<mutex> guard(lock);
+    while (busyWorkers > 0) {
+        finished.wait(guard);
+    }
+    body = nullptr;
+}
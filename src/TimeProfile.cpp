@@ -0,0 +1,143 @@
+#include "TimeProfile.h"
+#include "Logger.h"
+
+TravelTimeProfiles::TravelTimeProfiles(int periodLength)
+    : period(periodLength > 0 ? periodLength : 1440) {
+    offsets.push_back(0);
+    internTable.assign(16, -1);
+}
+
+// FNV-1a over the breakpoints - Time: O(points)
+unsigned int TravelTimeProfiles::hashPoints(const vector<int>& pointTimes, const vector<int>& values) const {
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < pointTimes.size(); i++) {
+        hash = (hash ^ (unsigned int)pointTimes[i]) * 16777619u;
+        hash = (hash ^ (unsigned int)values[i]) * 16777619u;
+    }
+    return hash;
+}
+
+bool TravelTimeProfiles::samePoints(int id, const vector<int>& pointTimes, const vector<int>& values) const {
+    int begin = offsets[id];
+    if (offsets[id + 1] - begin != (int)pointTimes.size()) return false;
+    for (size_t i = 0; i < pointTimes.size(); i++) {
+        if (times[begin + i] != pointTimes[i] || travelTimes[begin + i] != values[i]) return false;
+    }
+    return true;
+}
+
+// Doubles the intern table and re-inserts every profile - Time: O(total points)
+void TravelTimeProfiles::growInternTable() {
+    vector<int> larger(internTable.size() * 2, -1);
+    unsigned int mask = larger.size() - 1;
+    for (int id = 0; id < getNumProfiles(); id++) {
+        vector<int> pointTimes(times.begin() + offsets[id], times.begin() + offsets[id + 1]);
+        vector<int> values(travelTimes.begin() + offsets[id], travelTimes.begin() + offsets[id + 1]);
+        unsigned int slot = hashPoints(pointTimes, values) & mask;
+        while (larger[slot] != -1) slot = (slot + 1) & mask;
+        larger[slot] = id;
+    }
+    internTable.swap(larger);
+}
+
+int TravelTimeProfiles::addProfile(const vector<int>& pointTimes, const vector<int>& values) {
+    int n = pointTimes.size();
+    if (n == 0 || (int)values.size() != n) {
+        LOG_ERROR("Invalid profile: breakpoint times and travel times must be non-empty and of equal length!");
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        if (pointTimes[i] < 0 || pointTimes[i] >= period || values[i] < 0 ||
+            (i > 0 && pointTimes[i] <= pointTimes[i - 1])) {
+            LOG_ERROR("Invalid profile: times must increase within [0, " << period
+                      << ") and travel times must be non-negative!");
+            return -1;
+        }
+    }
+    
+    // FIFO: over every segment (including the wrap-around one) the travel time
+    // may drop by at most the time that passes
+    for (int i = 0; i < n && n > 1; i++) {
+        int nextTime = (i + 1 < n) ? pointTimes[i + 1] : pointTimes[0] + period;
+        int nextValue = (i + 1 < n) ? values[i + 1] : values[0];
+        if ((long long)nextValue - values[i] < -((long long)nextTime - pointTimes[i])) {
+            LOG_ERROR("Invalid profile: travel time drops faster than time passes (violates FIFO)!");
+            return -1;
+        }
+    }
+    
+    unsigned int mask = internTable.size() - 1;
+    unsigned int slot = hashPoints(pointTimes, values) & mask;
+    while (internTable[slot] != -1) {
+        if (samePoints(internTable[slot], pointTimes, values)) return internTable[slot];
+        slot = (slot + 1) & mask;
+    }
+    
+    int id = getNumProfiles();
+    for (int i = 0; i < n; i++) {
+        times.push_back(pointTimes[i]);
+        travelTimes.push_back(values[i]);
+    }
+    offsets.push_back(times.size());
+    internTable[slot] = id;
+    if ((long long)(id + 1) * 2 > (long long)internTable.size()) growInternTable();
+    return id;
+}
+
+// Evaluate - binary search for the segment around t, then linear interpolation
+// (rounded down, which keeps integer arrival times FIFO)
+int TravelTimeProfiles::evaluate(int id, int t) const {
+    if (id < 0 || id >= getNumProfiles()) return 0;
+    int begin = offsets[id];
+    int end = offsets[id + 1];
+    if (end - begin == 1) return travelTimes[begin];
+    
+    int local = t % period;
+    if (local < 0) local += period;
+    
+    // Last breakpoint with time <= local, or -1 if local is before the first one
+    int low = begin, high = end - 1, found = -1;
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        if (times[mid] <= local) {
+            found = mid;
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    
+    long long t0, t1, v0, v1;
+    if (found == -1) {
+        t0 = times[end - 1] - period;
+        v0 = travelTimes[end - 1];
+        t1 = times[begin];
+        v1 = travelTimes[begin];
+    } else {
+        t0 = times[found];
+        v0 = travelTimes[found];
+        t1 = (found + 1 < end) ? times[found + 1] : times[begin] + period;
+        v1 = (found + 1 < end) ? travelTimes[found + 1] : travelTimes[begin];
+    }
+    
+    long long numerator = (v1 - v0) * (local - t0);
+    long long span = t1 - t0;
+    long long step = numerator / span;
+    if (numerator % span != 0 && numerator < 0) step--;  // Floor, not truncation
+    return (int)(v0 + step);
+}
+
+// Minimum over the period - the curve is linear between breakpoints. Time: O(points)
+int TravelTimeProfiles::minTravelTime(int id) const {
+    if (id < 0 || id >= getNumProfiles()) return 0;
+    int best = travelTimes[offsets[id]];
+    for (int i = offsets[id] + 1; i < offsets[id + 1]; i++) {
+        if (travelTimes[i] < best) best = travelTimes[i];
+    }
+    return best;
+}
+
+long long TravelTimeProfiles::getMemoryUsage() const {
+    return (long long)sizeof(int) * (offsets.capacity() + times.capacity() +
+                                     travelTimes.capacity() + internTable.capacity());
+}
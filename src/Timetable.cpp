@@ -0,0 +1,314 @@
+#include "Timetable.h"
+#include "Graph.h"
+#include "Logger.h"
+#include "SearchSort.h"
+
+Timetable::Timetable(const Graph& network)
+    : numStops(0), graph(&network), dirty(true), lastRounds(0) {
+    patternOffsets.push_back(0);
+    tripOffsets.push_back(0);
+}
+
+// Add Route - Time: O(stops), Space: O(stops)
+int Timetable::addRoute(const vector<int>& stops) {
+    if (stops.size() < 2) {
+        LOG_ERROR("Invalid route: a route needs at least two stops!");
+        return -1;
+    }
+    for (size_t i = 0; i < stops.size(); i++) {
+        if (!graph->stationExists(stops[i])) {
+            LOG_ERROR("Invalid route: station " << stops[i] << " does not exist!");
+            return -1;
+        }
+    }
+    
+    for (size_t i = 0; i < stops.size(); i++) {
+        patternStops.push_back(stops[i]);
+    }
+    patternOffsets.push_back(patternStops.size());
+    dirty = true;
+    return patternOffsets.size() - 2;
+}
+
+// Add Trip - times must never run backwards along the route. Time: O(stops)
+bool Timetable::addTrip(int route, const vector<int>& arrivalTimes, const vector<int>& departureTimes) {
+    if (route < 0 || route >= (int)patternOffsets.size() - 1) {
+        LOG_ERROR("Invalid trip: route " << route << " does not exist!");
+        return false;
+    }
+    int stops = patternOffsets[route + 1] - patternOffsets[route];
+    if ((int)arrivalTimes.size() != stops || (int)departureTimes.size() != stops) {
+        LOG_ERROR("Invalid trip: expected " << stops << " arrival and departure times!");
+        return false;
+    }
+    for (int i = 0; i < stops; i++) {
+        if (arrivalTimes[i] > departureTimes[i] || (i + 1 < stops && departureTimes[i] > arrivalTimes[i + 1])) {
+            LOG_ERROR("Invalid trip: stop times must not decrease along the route!");
+            return false;
+        }
+    }
+    
+    tripPattern.push_back(route);
+    for (int i = 0; i < stops; i++) {
+        tripArrivals.push_back(arrivalTimes[i]);
+        tripDepartures.push_back(departureTimes[i]);
+    }
+    tripOffsets.push_back(tripArrivals.size());
+    dirty = true;
+    return true;
+}
+
+// Add Transfer - one-way walking link. Time: O(1)
+// Queries follow a single transfer after each trip, so chains of walks
+// should be added as direct transfers.
+bool Timetable::addTransfer(int from, int to, int walkTime) {
+    if (!graph->stationExists(from) || !graph->stationExists(to) || from == to || walkTime < 0) {
+        LOG_ERROR("Invalid transfer!");
+        return false;
+    }
+    transferFrom.push_back(from);
+    transferTo.push_back(to);
+    transferWalk.push_back(walkTime);
+    dirty = true;
+    return true;
+}
+
+// Sort staged trips by (first departure, last arrival, ID)
+// Time: O(T log T), Space: O(T)
+void Timetable::sortTripsByDeparture(vector<int>& trips) const {
+    SearchSort::stableSort(trips, [this](int a, int b) {
+        int depA = tripDepartures[tripOffsets[a]], depB = tripDepartures[tripOffsets[b]];
+        int arrA = tripArrivals[tripOffsets[a + 1] - 1], arrB = tripArrivals[tripOffsets[b + 1] - 1];
+        return depA < depB || (depA == depB && (arrA < arrB || (arrA == arrB && a < b)));
+    });
+}
+
+// True if laterTrip is earlier than earlierTrip at some stop
+bool Timetable::overtakes(int laterTrip, int earlierTrip, int stops) const {
+    int a = tripOffsets[laterTrip], b = tripOffsets[earlierTrip];
+    for (int i = 0; i < stops; i++) {
+        if (tripArrivals[a + i] < tripArrivals[b + i] || tripDepartures[a + i] < tripDepartures[b + i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Finalize - packs the staging area into the flat query arrays
+// Time: O(T log T + stop times + routes x chains), Space: O(stop times)
+void Timetable::finalize() {
+    numStops = graph->getNumVertices();
+    int patterns = patternOffsets.size() - 1;
+    
+    // Group trips by the route they were added to
+    vector<int> firstTrip(patterns + 1, 0);
+    for (size_t t = 0; t < tripPattern.size(); t++) firstTrip[tripPattern[t] + 1]++;
+    for (int p = 0; p < patterns; p++) firstTrip[p + 1] += firstTrip[p];
+    vector<int> grouped(tripPattern.size());
+    vector<int> fill(firstTrip.begin(), firstTrip.end() - 1);
+    for (size_t t = 0; t < tripPattern.size(); t++) grouped[fill[tripPattern[t]]++] = t;
+    
+    routeStopOffsets.assign(1, 0);
+    routeStops.clear();
+    routeTripCount.clear();
+    routeTimeOffsets.assign(1, 0);
+    arrivals.clear();
+    departures.clear();
+    
+    for (int p = 0; p < patterns; p++) {
+        int stops = patternOffsets[p + 1] - patternOffsets[p];
+        vector<int> trips(grouped.begin() + firstTrip[p], grouped.begin() + firstTrip[p + 1]);
+        if (trips.empty()) continue;
+        sortTripsByDeparture(trips);
+        
+        // Greedily split into chains in which no trip overtakes its predecessor
+        vector<vector<int>> chains;
+        for (size_t i = 0; i < trips.size(); i++) {
+            size_t c = 0;
+            while (c < chains.size() && overtakes(trips[i], chains[c].back(), stops)) c++;
+            if (c == chains.size()) chains.push_back(vector<int>());
+            chains[c].push_back(trips[i]);
+        }
+        
+        for (size_t c = 0; c < chains.size(); c++) {
+            for (int i = 0; i < stops; i++) routeStops.push_back(patternStops[patternOffsets[p] + i]);
+            routeStopOffsets.push_back(routeStops.size());
+            routeTripCount.push_back(chains[c].size());
+            for (size_t t = 0; t < chains[c].size(); t++) {
+                int offset = tripOffsets[chains[c][t]];
+                for (int i = 0; i < stops; i++) {
+                    arrivals.push_back(tripArrivals[offset + i]);
+                    departures.push_back(tripDepartures[offset + i]);
+                }
+            }
+            routeTimeOffsets.push_back(arrivals.size());
+        }
+    }
+    
+    // Routes serving each stop, with the stop's position on the route
+    int routes = routeTripCount.size();
+    stopRouteOffsets.assign(numStops + 1, 0);
+    for (size_t i = 0; i < routeStops.size(); i++) stopRouteOffsets[routeStops[i] + 1]++;
+    for (int s = 0; s < numStops; s++) stopRouteOffsets[s + 1] += stopRouteOffsets[s];
+    stopRoutes.assign(routeStops.size(), 0);
+    stopRoutePositions.assign(routeStops.size(), 0);
+    vector<int> next(stopRouteOffsets.begin(), stopRouteOffsets.end() - 1);
+    for (int r = 0; r < routes; r++) {
+        for (int i = routeStopOffsets[r]; i < routeStopOffsets[r + 1]; i++) {
+            int slot = next[routeStops[i]]++;
+            stopRoutes[slot] = r;
+            stopRoutePositions[slot] = i - routeStopOffsets[r];
+        }
+    }
+    
+    // Transfers in CSR form by origin stop
+    transferOffsets.assign(numStops + 1, 0);
+    for (size_t i = 0; i < transferFrom.size(); i++) transferOffsets[transferFrom[i] + 1]++;
+    for (int s = 0; s < numStops; s++) transferOffsets[s + 1] += transferOffsets[s];
+    transferTargets.assign(transferFrom.size(), 0);
+    transferTimes.assign(transferFrom.size(), 0);
+    next.assign(transferOffsets.begin(), transferOffsets.end() - 1);
+    for (size_t i = 0; i < transferFrom.size(); i++) {
+        int slot = next[transferFrom[i]]++;
+        transferTargets[slot] = transferTo[i];
+        transferTimes[slot] = transferWalk[i];
+    }
+    
+    earliest.assign(numStops, INT_MAX);
+    boardable.assign(numStops, INT_MAX);
+    isMarked.assign(numStops, false);
+    marked.clear();
+    routeQueuePos.assign(routes, -1);
+    queuedRoutes.clear();
+    dirty = false;
+}
+
+int Timetable::getNumRoutes() {
+    if (dirty) finalize();
+    return routeTripCount.size();
+}
+
+// Earliest trip of route leaving the stop at position no earlier than time,
+// -1 if none. Departures at every position are sorted across trips.
+// Time: O(log trips)
+int Timetable::findTrip(int route, int position, int time) const {
+    int stops = routeStopOffsets[route + 1] - routeStopOffsets[route];
+    const int* column = &departures[routeTimeOffsets[route] + position];
+    int low = 0, high = routeTripCount[route] - 1, found = -1;
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        if (column[mid * stops] >= time) {
+            found = mid;
+            high = mid - 1;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return found;
+}
+
+void Timetable::improve(int stop, int time) {
+    earliest[stop] = time;
+    if (!isMarked[stop]) {
+        isMarked[stop] = true;
+        marked.push_back(stop);
+    }
+}
+
+// RAPTOR - Time: O(rounds x (stop times of scanned routes + transfers)), Space: O(S + R)
+// dest = -1 computes arrivals at every stop; otherwise arrivals later than
+// the best one at dest are pruned (target pruning).
+void Timetable::run(int src, int departureTime, int dest, int maxRounds) {
+    if (dirty) finalize();
+    for (int s = 0; s < numStops; s++) {
+        earliest[s] = INT_MAX;
+        boardable[s] = INT_MAX;
+    }
+    lastRounds = 0;
+    if (src < 0 || src >= numStops) return;
+    
+    marked.clear();
+    improve(src, departureTime);
+    for (int e = transferOffsets[src]; e < transferOffsets[src + 1]; e++) {
+        int arrival = departureTime + transferTimes[e];
+        if (arrival < earliest[transferTargets[e]]) improve(transferTargets[e], arrival);
+    }
+    for (size_t i = 0; i < marked.size(); i++) boardable[marked[i]] = earliest[marked[i]];
+    
+    for (int round = 1; round <= maxRounds && !marked.empty(); round++) {
+        // Queue every route through a stop improved last round, from its earliest such stop
+        queuedRoutes.clear();
+        for (size_t i = 0; i < marked.size(); i++) {
+            int p = marked[i];
+            isMarked[p] = false;
+            for (int e = stopRouteOffsets[p]; e < stopRouteOffsets[p + 1]; e++) {
+                int r = stopRoutes[e];
+                int position = stopRoutePositions[e];
+                if (routeQueuePos[r] == -1) {
+                    routeQueuePos[r] = position;
+                    queuedRoutes.push_back(r);
+                } else if (position < routeQueuePos[r]) {
+                    routeQueuePos[r] = position;
+                }
+            }
+        }
+        marked.clear();
+        
+        // Ride each queued route, hopping onto earlier trips where possible
+        for (size_t q = 0; q < queuedRoutes.size(); q++) {
+            int r = queuedRoutes[q];
+            int start = routeQueuePos[r];
+            routeQueuePos[r] = -1;
+            int stops = routeStopOffsets[r + 1] - routeStopOffsets[r];
+            const int* stopIds = &routeStops[routeStopOffsets[r]];
+            int base = routeTimeOffsets[r];
+            int trip = -1;
+            
+            for (int i = start; i < stops; i++) {
+                int p = stopIds[i];
+                if (trip != -1) {
+                    int arrival = arrivals[base + trip * stops + i];
+                    int limit = earliest[p];
+                    if (dest != -1 && earliest[dest] < limit) limit = earliest[dest];
+                    if (arrival < limit) improve(p, arrival);
+                }
+                if (boardable[p] != INT_MAX &&
+                    (trip == -1 || boardable[p] < departures[base + trip * stops + i])) {
+                    int earlier = findTrip(r, i, boardable[p]);
+                    if (earlier != -1 && (trip == -1 || earlier < trip)) trip = earlier;
+                }
+            }
+        }
+        
+        // One walking transfer after each improved arrival
+        size_t arrivedByTrip = marked.size();
+        for (size_t i = 0; i < arrivedByTrip; i++) {
+            int p = marked[i];
+            for (int e = transferOffsets[p]; e < transferOffsets[p + 1]; e++) {
+                int q = transferTargets[e];
+                int arrival = earliest[p] + transferTimes[e];
+                int limit = earliest[q];
+                if (dest != -1 && earliest[dest] < limit) limit = earliest[dest];
+                if (arrival < limit) improve(q, arrival);
+            }
+        }
+        
+        for (size_t i = 0; i < marked.size(); i++) boardable[marked[i]] = earliest[marked[i]];
+        lastRounds = round;
+    }
+    
+    for (size_t i = 0; i < marked.size(); i++) isMarked[marked[i]] = false;
+    marked.clear();
+}
+
+int Timetable::earliestArrival(int src, int dest, int departureTime, int maxRounds) {
+    if (dirty) finalize();
+    if (dest < 0 || dest >= numStops) return INT_MAX;
+    run(src, departureTime, dest, maxRounds);
+    return earliest[dest];
+}
+
+vector<int> Timetable::earliestArrivalAll(int src, int departureTime, int maxRounds) {
+    run(src, departureTime, -1, maxRounds);
+    return earliest;
+}
@@ -0,0 +1,252 @@
+#include "VehicleIndex.h"
+#include "SearchSort.h"
+#include <cmath>
+#include <climits>
+
+const int OrderedIndex::BLOCK_SIZE;
+
+double OrderedIndex::normalize(double key) {
+    return (key != key) ? HUGE_VAL : key;  // NaN sorts as +infinity
+}
+
+bool OrderedIndex::less(double keyA, int idA, double keyB, int idB) {
+    return keyA < keyB || (keyA == keyB && idA < idB);
+}
+
+// Find Block - binary search over block ends - Time: O(log blocks)
+// Returns blocks.size() if every entry is below (key, id)
+int OrderedIndex::findBlock(double key, int id) const {
+    int low = 0;
+    int high = blockLast.size();
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (less(blockLast[mid].key, blockLast[mid].id, key, id)) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+// Lower Bound - first position not below (key, id) - Time: O(log BLOCK_SIZE)
+int OrderedIndex::lowerBound(const vector<Entry>& block, double key, int id) {
+    int low = 0;
+    int high = block.size();
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (less(block[mid].key, block[mid].id, key, id)) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+// Insert - Time: O(log n + BLOCK_SIZE), plus O(blocks) when a block splits
+void OrderedIndex::insert(double key, int id) {
+    key = normalize(key);
+    Entry entry;
+    entry.key = key;
+    entry.id = id;
+    if (blocks.empty()) {
+        blocks.push_back(vector<Entry>(1, entry));
+        blockLast.push_back(entry);
+        count = 1;
+        return;
+    }
+    
+    int b = findBlock(key, id);
+    if (b == (int)blocks.size()) b--;  // Past the last entry: append to the last block
+    vector<Entry>& block = blocks[b];
+    block.insert(block.begin() + lowerBound(block, key, id), entry);
+    blockLast[b] = block.back();
+    count++;
+    
+    if ((int)block.size() > BLOCK_SIZE) {
+        // Split in halves; the upper half becomes block b + 1
+        vector<Entry> upper(block.begin() + BLOCK_SIZE / 2, block.end());
+        block.resize(BLOCK_SIZE / 2);
+        blockLast[b] = block.back();
+        blockLast.insert(blockLast.begin() + b + 1, upper.back());
+        blocks.insert(blocks.begin() + b + 1, vector<Entry>());
+        blocks[b + 1].swap(upper);
+    }
+}
+
+// Insert Batch - pairs must not be indexed yet
+// Time: O(b log b + n) by sort and merge, or O(b (log n + BLOCK_SIZE)) for a
+// small batch, Space: O(n + b)
+void OrderedIndex::insertBatch(const vector<Entry>& batch) {
+    int n = batch.size();
+    if (n == 0) return;
+    
+    // Few pairs into a large index: plain inserts are cheaper than a rebuild
+    if ((long long)n * 16 < count) {
+        for (int i = 0; i < n; i++) insert(batch[i].key, batch[i].id);
+        return;
+    }
+    
+    // Sort the batch (skipped when already in order)
+    vector<Entry> sorted(batch);
+    for (int i = 0; i < n; i++) sorted[i].key = normalize(sorted[i].key);
+    SearchSort::stableSort(sorted, [](const Entry& a, const Entry& b) {
+        return less(a.key, a.id, b.key, b.id);
+    });
+    
+    // Merge with the current entries into blocks three quarters full, leaving
+    // room for later inserts before the first splits
+    vector<vector<Entry> > merged;
+    vector<Entry> current;
+    current.reserve(BLOCK_SIZE);
+    int fill = BLOCK_SIZE * 3 / 4;
+    int b = 0;
+    int s = 0;
+    int i = 0;
+    while (s < n || b < (int)blocks.size()) {
+        Entry next;
+        bool fromBatch = b == (int)blocks.size() ||
+                         (s < n && less(sorted[s].key, sorted[s].id, blocks[b][i].key, blocks[b][i].id));
+        if (fromBatch) {
+            next = sorted[s++];
+        } else {
+            next = blocks[b][i++];
+            if (i == (int)blocks[b].size()) {
+                vector<Entry>().swap(blocks[b]);  // Release merged blocks as we go
+                b++;
+                i = 0;
+            }
+        }
+        current.push_back(next);
+        if ((int)current.size() == fill) {
+            merged.push_back(vector<Entry>());
+            merged.back().swap(current);
+            current.reserve(BLOCK_SIZE);
+        }
+    }
+    if (!current.empty()) merged.push_back(current);
+    
+    blocks.swap(merged);
+    blockLast.resize(blocks.size());
+    for (size_t k = 0; k < blocks.size(); k++) blockLast[k] = blocks[k].back();
+    count += n;
+}
+
+// Remove - Time: O(log n + BLOCK_SIZE), plus O(blocks) when a block empties
+bool OrderedIndex::remove(double key, int id) {
+    key = normalize(key);
+    int b = findBlock(key, id);
+    if (b == (int)blocks.size()) return false;
+    vector<Entry>& block = blocks[b];
+    int position = lowerBound(block, key, id);
+    if (position == (int)block.size() || block[position].key != key || block[position].id != id) return false;
+    
+    block.erase(block.begin() + position);
+    count--;
+    if (block.empty()) {
+        blocks.erase(blocks.begin() + b);
+        blockLast.erase(blockLast.begin() + b);
+    } else {
+        blockLast[b] = block.back();
+    }
+    return true;
+}
+
+void OrderedIndex::clear() {
+    blocks.clear();
+    blockLast.clear();
+    count = 0;
+}
+
+// Find Range - Time: O(log n + k), Space: O(k)
+void OrderedIndex::findRange(double low, double high, vector<int>& ids) const {
+    low = normalize(low);
+    high = normalize(high);
+    if (high < low) return;
+    int first = findBlock(low, INT_MIN);
+    for (int b = first; b < (int)blocks.size(); b++) {
+        const vector<Entry>& block = blocks[b];
+        int i = (b == first) ? lowerBound(block, low, INT_MIN) : 0;
+        for (; i < (int)block.size(); i++) {
+            if (block[i].key > high) return;
+            ids.push_back(block[i].id);
+        }
+    }
+}
+
+// Count Range - whole blocks inside the range are counted by size
+// Time: O(log n + k / BLOCK_SIZE)
+int OrderedIndex::countRange(double low, double high) const {
+    low = normalize(low);
+    high = normalize(high);
+    if (high < low) return 0;
+    int first = findBlock(low, INT_MIN);
+    int total = 0;
+    for (int b = first; b < (int)blocks.size(); b++) {
+        const vector<Entry>& block = blocks[b];
+        int start = (b == first) ? lowerBound(block, low, INT_MIN) : 0;
+        if (block.back().key <= high) {
+            total += block.size() - start;
+            continue;
+        }
+        // Last block touched: everything from start up to the first key above high
+        int lowPos = start;
+        int highPos = block.size();
+        while (lowPos < highPos) {
+            int mid = lowPos + (highPos - lowPos) / 2;
+            if (block[mid].key <= high) lowPos = mid + 1;
+            else highPos = mid;
+        }
+        return total + lowPos - start;
+    }
+    return total;
+}
+
+// Search Name - binary search over the sorted names - Time: O(log c)
+// Returns the category ID, or -1 with position set to where the name belongs
+int CategoryIndex::searchName(const string& name, int& position) const {
+    int low = 0;
+    int high = sortedIds.size();
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        int compare = names[sortedIds[mid]].compare(name);
+        if (compare == 0) return sortedIds[mid];
+        if (compare < 0) low = mid + 1;
+        else high = mid;
+    }
+    position = low;
+    return -1;
+}
+
+// Intern - Time: O(log c) for a known name, O(c) to add one
+int CategoryIndex::intern(const string& name) {
+    int position = 0;
+    int category = searchName(name, position);
+    if (category != -1) return category;
+    category = names.size();
+    names.push_back(name);
+    members.push_back(vector<int>());
+    sortedIds.insert(sortedIds.begin() + position, category);
+    return category;
+}
+
+int CategoryIndex::find(const string& name) const {
+    int position = 0;
+    return searchName(name, position);
+}
+
+int CategoryIndex::add(int category, int handle) {
+    members[category].push_back(handle);
+    return members[category].size() - 1;
+}
+
+// Remove At - the last member fills the gap - Time: O(1)
+int CategoryIndex::removeAt(int category, int position) {
+    vector<int>& list = members[category];
+    int moved = -1;
+    if (position != (int)list.size() - 1) {
+        moved = list.back();
+        list[position] = moved;
+    }
+    list.pop_back();
+    return moved;
+}
+
+void CategoryIndex::clear() {
+    for (size_t i = 0; i < members.size(); i++) members[i].clear();
+}
@@ -0,0 +1,312 @@
+#include "VehicleRegistry.h"
+
+const int VehicleRegistry::MAX_READERS;
+const int VehicleRegistry::MAX_SHARDS;
+const int VehicleRegistry::MIN_TABLE;
+const size_t VehicleRegistry::RECLAIM_BATCH;
+
+// Reader slot numbers are shared by all registries: a thread takes a free
+// number on its first lookup and gives it back when it exits, so pools that
+// come and go do not use up the MAX_READERS slots
+static mutex readerIdMutex;
+static vector<int> freeReaderIds;
+static atomic<int> readerIdsIssued(0);  // Slots [0, issued) may be in use
+
+struct ReaderId {
+    int index;
+    ReaderId() {
+        lock_guard<mutex> lock(readerIdMutex);
+        if (!freeReaderIds.empty()) {
+            index = freeReaderIds.back();
+            freeReaderIds.pop_back();
+        } else if (readerIdsIssued.load() < VehicleRegistry::MAX_READERS) {
+            index = readerIdsIssued.fetch_add(1);
+        } else {
+            index = -1;
+        }
+    }
+    ~ReaderId() {
+        if (index < 0) return;
+        lock_guard<mutex> lock(readerIdMutex);
+        freeReaderIds.push_back(index);
+    }
+};
+
+static thread_local ReaderId readerId;
+
+VehicleRegistry::Table::Table(int size) : capacity(size), slots(new atomic<Record*>[size]) {
+    for (int i = 0; i < size; i++) slots[i].store(nullptr, memory_order_relaxed);
+}
+
+VehicleRegistry::Table::~Table() {
+    delete[] slots;  // Records are owned by the registry, not by the table
+}
+
+VehicleRegistry::VehicleRegistry(int shardCount) : numShards(1), globalEpoch(1) {
+    while (numShards < shardCount && numShards < MAX_SHARDS) numShards *= 2;
+    shards = new Shard[numShards];
+    for (int i = 0; i < numShards; i++) {
+        shards[i].table.store(new Table(MIN_TABLE), memory_order_relaxed);
+    }
+    readers = new ReaderSlot[MAX_READERS];
+}
+
+// No reader or writer may still be running
+VehicleRegistry::~VehicleRegistry() {
+    for (int i = 0; i < numShards; i++) {
+        Table* table = shards[i].table.load();
+        for (int slot = 0; slot < table->capacity; slot++) {
+            Record* record = table->slots[slot].load();
+            if (record != nullptr && record != tombstone()) delete record;
+        }
+        delete table;
+        vector<Retired>& retired = shards[i].retired;
+        for (size_t r = 0; r < retired.size(); r++) {
+            delete retired[r].record;
+            delete retired[r].table;
+        }
+    }
+    delete[] shards;
+    delete[] readers;
+}
+
+VehicleRegistry::Record* VehicleRegistry::tombstone() {
+    static Record removed(-1, "", "", 0, 0.0);
+    return &removed;
+}
+
+unsigned long long VehicleRegistry::hashKey(int id) {
+    unsigned long long hash = (unsigned int)id * 0x9E3779B97F4A7C15ULL;
+    return hash ^ (hash >> 32);
+}
+
+// Find Slot - linear probing, stops at the first empty slot
+// Average Time: O(1), Worst: O(capacity), Space: O(1)
+int VehicleRegistry::findSlot(const Table* table, int id, unsigned long long hash) {
+    int mask = table->capacity - 1;
+    int slot = hash & mask;
+    for (int step = 0; step < table->capacity; step++) {
+        Record* record = table->slots[slot].load();
+        if (record == nullptr) return -1;
+        if (record != tombstone() && record->id == id) return slot;
+        slot = (slot + 1) & mask;
+    }
+    return -1;
+}
+
+// Find - the probe of findSlot, returning the record it loaded; a second load
+// of the slot could see a tombstone or another ID written in between
+const VehicleRegistry::Record* VehicleRegistry::find(int id) const {
+    unsigned long long hash = hashKey(id);
+    const Table* table = shardOf(hash).table.load();
+    int mask = table->capacity - 1;
+    int slot = hash & mask;
+    for (int step = 0; step < table->capacity; step++) {
+        const Record* record = table->slots[slot].load();
+        if (record == nullptr) return nullptr;
+        if (record != tombstone() && record->id == id) return record;
+        slot = (slot + 1) & mask;
+    }
+    return nullptr;
+}
+
+// Begin Read - announces the epoch this reader started in - Time: O(1)
+// The seq_cst store is ordered before every pointer the reader loads next, so a
+// writer scanning the slots afterwards either sees the announcement or retired
+// the pointer before the reader could load it
+int VehicleRegistry::beginRead() const {
+    int slot = readerId.index;
+    if (slot < 0) return -1;
+    readers[slot].epoch.store(globalEpoch.load());
+    return slot;
+}
+
+void VehicleRegistry::endRead(int slot) const {
+    readers[slot].epoch.store(0, memory_order_release);
+}
+
+// Retire - tags unlinked memory with the current epoch - Amortized Time: O(1)
+void VehicleRegistry::retire(Shard& shard, Record* record, Table* table) {
+    Retired entry;
+    entry.record = record;
+    entry.table = table;
+    entry.epoch = globalEpoch.load();
+    shard.retired.push_back(entry);
+    if (shard.retired.size() >= shard.reclaimAt) reclaim(shard);
+}
+
+// Reclaim - frees what no active reader can still reach
+// Time: O(MAX_READERS + retired), run once per RECLAIM_BATCH retirements
+void VehicleRegistry::reclaim(Shard& shard) {
+    // Readers that announce after this point load the current pointers only
+    unsigned long long oldestActive = globalEpoch.fetch_add(1) + 1;
+    int issued = readerIdsIssued.load();
+    for (int i = 0; i < issued; i++) {
+        unsigned long long epoch = readers[i].epoch.load();
+        if (epoch != 0 && epoch < oldestActive) oldestActive = epoch;
+    }
+    
+    vector<Retired>& retired = shard.retired;
+    size_t kept = 0;
+    for (size_t r = 0; r < retired.size(); r++) {
+        if (retired[r].epoch < oldestActive) {
+            delete retired[r].record;
+            delete retired[r].table;
+        } else {
+            retired[kept++] = retired[r];
+        }
+    }
+    retired.resize(kept);
+    // A stalled reader keeps entries alive; do not rescan on every retirement
+    shard.reclaimAt = kept + RECLAIM_BATCH;
+}
+
+// Rebuild - copies the live records into a fresh table (drops tombstones,
+// grows if needed) and publishes it; the old table is retired
+// Time: O(capacity), Space: O(live)
+void VehicleRegistry::rebuild(Shard& shard) {
+    Table* oldTable = shard.table.load(memory_order_relaxed);
+    int live = shard.live.load(memory_order_relaxed);
+    int newCapacity = MIN_TABLE;
+    while (newCapacity < (live + 1) * 4) newCapacity *= 2;  // At most a quarter full afterwards
+    
+    Table* newTable = new Table(newCapacity);
+    int mask = newCapacity - 1;
+    for (int i = 0; i < oldTable->capacity; i++) {
+        Record* record = oldTable->slots[i].load(memory_order_relaxed);
+        if (record == nullptr || record == tombstone()) continue;
+        int slot = hashKey(record->id) & mask;
+        while (newTable->slots[slot].load(memory_order_relaxed) != nullptr) slot = (slot + 1) & mask;
+        newTable->slots[slot].store(record, memory_order_relaxed);
+    }
+    shard.table.store(newTable);
+    shard.usedSlots = live;
+    retire(shard, nullptr, oldTable);
+}
+
+// Insert - Average Time: O(1), Space: O(1)
+bool VehicleRegistry::insert(const Vehicle& vehicle) {
+    unsigned long long hash = hashKey(vehicle.id);
+    Shard& shard = shardOf(hash);
+    lock_guard<mutex> lock(shard.writer);
+    Record* record = new Record(vehicle.id, vehicle.type, vehicle.model, vehicle.capacity, vehicle.speed);
+    
+    Table* table = shard.table.load(memory_order_relaxed);
+    int slot = findSlot(table, vehicle.id, hash);
+    if (slot >= 0) {
+        Record* old = table->slots[slot].load(memory_order_relaxed);
+        table->slots[slot].store(record);
+        retire(shard, old, nullptr);
+        return false;
+    }
+    
+    if ((shard.usedSlots + 1) * 2 > table->capacity) {
+        rebuild(shard);
+        table = shard.table.load(memory_order_relaxed);
+    }
+    // The ID is absent, so the first empty or removed slot on its path is free
+    int mask = table->capacity - 1;
+    slot = hash & mask;
+    while (true) {
+        Record* current = table->slots[slot].load(memory_order_relaxed);
+        if (current == nullptr || current == tombstone()) {
+            if (current == nullptr) shard.usedSlots++;
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    table->slots[slot].store(record);
+    shard.live.fetch_add(1, memory_order_relaxed);
+    return true;
+}
+
+// Remove - Average Time: O(1), Space: O(1)
+bool VehicleRegistry::remove(int id) {
+    unsigned long long hash = hashKey(id);
+    Shard& shard = shardOf(hash);
+    lock_guard<mutex> lock(shard.writer);
+    Table* table = shard.table.load(memory_order_relaxed);
+    int slot = findSlot(table, id, hash);
+    if (slot < 0) return false;
+    
+    Record* old = table->slots[slot].load(memory_order_relaxed);
+    table->slots[slot].store(tombstone());  // Keeps later records on the probe path reachable
+    shard.live.fetch_sub(1, memory_order_relaxed);
+    retire(shard, old, nullptr);
+    return true;
+}
+
+// Update Telemetry - publishes a new record with the new capacity and speed
+// Average Time: O(1), Space: O(1)
+bool VehicleRegistry::updateTelemetry(int id, int capacity, double speed) {
+    unsigned long long hash = hashKey(id);
+    Shard& shard = shardOf(hash);
+    lock_guard<mutex> lock(shard.writer);
+    Table* table = shard.table.load(memory_order_relaxed);
+    int slot = findSlot(table, id, hash);
+    if (slot < 0) return false;
+    
+    Record* old = table->slots[slot].load(memory_order_relaxed);
+    table->slots[slot].store(new Record(id, old->type, old->model, capacity, speed));
+    retire(shard, old, nullptr);
+    return true;
+}
+
+// Lookup - wait-free, Average Time: O(1), Space: O(1)
+bool VehicleRegistry::lookup(int id, Vehicle& result) const {
+    int slot = beginRead();
+    unique_lock<mutex> fallback;
+    if (slot < 0) fallback = unique_lock<mutex>(shardOf(hashKey(id)).writer);
+    
+    const Record* record = find(id);
+    if (record != nullptr) {
+        result.id = record->id;
+        result.type = record->type;
+        result.model = record->model;
+        result.capacity = record->capacity;
+        result.speed = record->speed;
+    }
+    if (slot >= 0) endRead(slot);
+    return record != nullptr;
+}
+
+// Get Telemetry - wait-free, Average Time: O(1), Space: O(1)
+bool VehicleRegistry::getTelemetry(int id, int& capacity, double& speed) const {
+    int slot = beginRead();
+    unique_lock<mutex> fallback;
+    if (slot < 0) fallback = unique_lock<mutex>(shardOf(hashKey(id)).writer);
+    
+    const Record* record = find(id);
+    if (record != nullptr) {
+        capacity = record->capacity;
+        speed = record->speed;
+    }
+    if (slot >= 0) endRead(slot);
+    return record != nullptr;
+}
+
+bool VehicleRegistry::contains(int id) const {
+    int slot = beginRead();
+    unique_lock<mutex> fallback;
+    if (slot < 0) fallback = unique_lock<mutex>(shardOf(hashKey(id)).writer);
+    
+    bool found = find(id) != nullptr;
+    if (slot >= 0) endRead(slot);
+    return found;
+}
+
+// Get Num Vehicles - Time: O(shards); a snapshot while writers are active
+int VehicleRegistry::getNumVehicles() const {
+    int total = 0;
+    for (int i = 0; i < numShards; i++) total += shards[i].live.load(memory_order_relaxed);
+    return total;
+}
+
+long long VehicleRegistry::getPendingReclaim() const {
+    long long total = 0;
+    for (int i = 0; i < numShards; i++) {
+        lock_guard<mutex> lock(shards[i].writer);
+        total += shards[i].retired.size();
+    }
+    return total;
+}
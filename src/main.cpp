@@ -10,6 +10,8 @@
 #include "Heap.h"
 #include "SearchSort.h"
 #include "Analytics.h"
+#include "Heuristic.h"
+#include "BulkLoader.h"
 
 using namespace std;
 
@@ -21,9 +23,13 @@ void vehicleMenu(HashTable& vehicleDB, Heap& vehicleHeap);
 void historyMenu(Stack& history, Graph& graph);
 void searchSortMenu();
 void analyticsMenu(Analytics& analytics);
+void bulkLoadMenu(Graph& graph, Queue& ticketQueue, HashTable& vehicleDB, BST& routeMetadata);
 void runTestSuite();
 
 int main() {
+    // Console output is block-buffered; cin is tied to cout, so prompts still appear before input
+    ios::sync_with_stdio(false);
+    
     cout << "\n" << string(70, '=') << endl;
     cout << "  INTELLIGENT TRANSPORT NETWORK MANAGEMENT SYSTEM (ITNMS)" << endl;
     cout << string(70, '=') << endl;
@@ -70,9 +76,12 @@ int main() {
                 analyticsMenu(analytics);
                 break;
             case 7:
-                runTestSuite();
+                bulkLoadMenu(transportGraph, ticketQueue, vehicleDB, routeMetadata);
                 break;
             case 8:
+                runTestSuite();
+                break;
+            case 9:
                 cout << "\nThank you for using ITNMS. Goodbye!" << endl;
                 running = false;
                 break;
@@ -99,14 +108,17 @@ void displayMainMenu() {
     cout << "4. History & Undo Operations (Stacks)" << endl;
     cout << "5. Searching & Sorting Module" << endl;
     cout << "6. Analytics & Reporting (Advanced DSA)" << endl;
-    cout << "7. Run Test Suite" << endl;
-    cout << "8. Exit" << endl;
+    cout << "7. Bulk Load from CSV Files" << endl;
+    cout << "8. Run Test Suite" << endl;
+    cout << "9. Exit" << endl;
     cout << string(70, '-') << endl;
 }
 
 void routeStationMenu(Graph& graph, Stack& history) {
     int choice;
     bool back = false;
+    LandmarkHeuristic landmarks;  // Loaded or rebuilt on first landmark route query
+    const string landmarkFile = "landmarks.bin";
     
     while (!back) {
         cout << "\n" << string(70, '-') << endl;
@@ -123,7 +135,8 @@ void routeStationMenu(Graph& graph, Stack& history) {
         cout << "9. Find Shortest Path (Dijkstra)" << endl;
         cout << "10. Generate Minimum Spanning Tree" << endl;
         cout << "11. Detect Cycle" << endl;
-        cout << "12. Back to Main Menu" << endl;
+        cout << "12. Find Route (A* with Landmarks)" << endl;
+        cout << "13. Back to Main Menu" << endl;
         cout << string(70, '-') << endl;
         cout << "Enter your choice: ";
         cin >> choice;
@@ -263,7 +276,39 @@ void routeStationMenu(Graph& graph, Stack& history) {
                 }
                 break;
             }
-            case 12:
+            case 12: {
+                cout << "Enter Source Station ID: ";
+                cin >> src;
+                cout << "Enter Destination Station ID: ";
+                cin >> dest;
+                cin.ignore();
+                // Reuse the saved tables unless the routes changed since they were built
+                if (!landmarks.matches(graph) &&
+                    (!landmarks.load(landmarkFile) || !landmarks.matches(graph))) {
+                    landmarks.build(graph, 8);
+                    if (landmarks.save(landmarkFile)) {
+                        cout << "Landmark tables rebuilt and saved to " << landmarkFile << endl;
+                    }
+                }
+                SearchStats stats;
+                vector<int> path = graph.aStar(src, dest, landmarks, &stats);
+                if (path.empty()) {
+                    cout << "No path exists from station " << src << " to " << dest << endl;
+                } else {
+                    cout << "Shortest distance from station " << src << " to " << dest << ": "
+                         << stats.distance << " (" << stats.settledNodes << " stations explored)" << endl;
+                    cout << "Path: ";
+                    for (size_t i = 0; i < path.size(); i++) {
+                        Station* s = graph.getStation(path[i]);
+                        cout << path[i];
+                        if (s) cout << "(" << s->name << ")";
+                        if (i < path.size() - 1) cout << " -> ";
+                    }
+                    cout << endl;
+                }
+                break;
+            }
+            case 13:
                 back = true;
                 break;
             default:
@@ -363,7 +408,8 @@ void vehicleMenu(HashTable& vehicleDB, Heap& vehicleHeap) {
         cout << "6. Add Vehicle to Priority Queue" << endl;
         cout << "7. Get Fastest Vehicle" << endl;
         cout << "8. Display Priority Queue" << endl;
-        cout << "9. Back to Main Menu" << endl;
+        cout << "9. Find Vehicles (Type / Capacity / Speed)" << endl;
+        cout << "10. Back to Main Menu" << endl;
         cout << string(70, '-') << endl;
         cout << "Enter your choice: ";
         cin >> choice;
@@ -395,7 +441,7 @@ void vehicleMenu(HashTable& vehicleDB, Heap& vehicleHeap) {
                 cout << "Enter Vehicle ID to search: ";
                 cin >> id;
                 cin.ignore();
-                Vehicle* v = vehicleDB.search(id);
+                const Vehicle* v = vehicleDB.search(id);
                 if (v) {
                     vehicleDB.displayVehicle(id);
                 } else {
@@ -417,14 +463,15 @@ void vehicleMenu(HashTable& vehicleDB, Heap& vehicleHeap) {
                 cout << "\n=== Hash Table Statistics ===" << endl;
                 cout << "Total Vehicles: " << vehicleDB.getNumVehicles() << endl;
                 cout << "Load Factor: " << vehicleDB.getLoadFactor() << endl;
-                cout << "Longest Chain: " << vehicleDB.getLongestChain() << endl;
+                cout << "Capacity: " << vehicleDB.getCapacity() << " slots" << endl;
+                cout << "Longest Probe: " << vehicleDB.getLongestProbe() << " group(s)" << endl;
                 break;
             }
             case 6: {
                 cout << "Enter Vehicle ID: ";
                 cin >> id;
                 cin.ignore();
-                Vehicle* v = vehicleDB.search(id);
+                const Vehicle* v = vehicleDB.search(id);
                 if (v) {
                     vehicleHeap.insert(VehiclePriority(v->id, v->speed, v->capacity, v->type));
                     cout << "Vehicle added to priority queue!" << endl;
@@ -436,7 +483,7 @@ void vehicleMenu(HashTable& vehicleDB, Heap& vehicleHeap) {
             case 7: {
                 if (!vehicleHeap.isEmpty()) {
                     VehiclePriority vp = vehicleHeap.peek();
-                    Vehicle* v = vehicleDB.search(vp.vehicleId);
+                    const Vehicle* v = vehicleDB.search(vp.vehicleId);
                     if (v) {
                         cout << "\nFastest Vehicle:" << endl;
                         vehicleDB.displayVehicle(vp.vehicleId);
@@ -449,7 +496,25 @@ void vehicleMenu(HashTable& vehicleDB, Heap& vehicleHeap) {
             case 8:
                 vehicleHeap.display();
                 break;
-            case 9:
+            case 9: {
+                VehicleFilter filter;
+                cout << "Enter Vehicle Type (blank for any): ";
+                getline(cin, filter.type);
+                cout << "Enter Capacity Range (min max): ";
+                cin >> filter.minCapacity >> filter.maxCapacity;
+                cout << "Enter Speed Range in km/h (min max): ";
+                cin >> filter.minSpeed >> filter.maxSpeed;
+                cin.ignore();
+                vector<int> ids = vehicleDB.findVehicles(filter);
+                cout << "\n" << ids.size() << " matching vehicle(s)" << endl;
+                for (size_t i = 0; i < ids.size(); i++) {
+                    const Vehicle* v = vehicleDB.search(ids[i]);
+                    cout << "  ID: " << v->id << " | Type: " << v->type << " | Model: " << v->model
+                         << " | Capacity: " << v->capacity << " | Speed: " << v->speed << " km/h" << endl;
+                }
+                break;
+            }
+            case 10:
                 back = true;
                 break;
             default:
@@ -759,9 +824,10 @@ void analyticsMenu(Analytics& analytics) {
         cout << "3. Fastest Vehicle Assignment" << endl;
         cout << "4. Traffic Density Prediction" << endl;
         cout << "5. Daily Usage Trends" << endl;
-        cout << "6. Generate Comprehensive Report" << endl;
-        cout << "7. Reset Statistics" << endl;
-        cout << "8. Back to Main Menu" << endl;
+        cout << "6. Critical Stations (Betweenness)" << endl;
+        cout << "7. Generate Comprehensive Report" << endl;
+        cout << "8. Reset Statistics" << endl;
+        cout << "9. Back to Main Menu" << endl;
         cout << string(70, '-') << endl;
         cout << "Enter your choice: ";
         cin >> choice;
@@ -784,12 +850,15 @@ void analyticsMenu(Analytics& analytics) {
                 analytics.dailyUsageTrends();
                 break;
             case 6:
-                analytics.generateReport();
+                analytics.criticalStations();
                 break;
             case 7:
-                analytics.resetStatistics();
+                analytics.generateReport();
                 break;
             case 8:
+                analytics.resetStatistics();
+                break;
+            case 9:
                 back = true;
                 break;
             default:
@@ -798,6 +867,73 @@ void analyticsMenu(Analytics& analytics) {
     }
 }
 
+void bulkLoadMenu(Graph& graph, Queue& ticketQueue, HashTable& vehicleDB, BST& routeMetadata) {
+    int choice;
+    bool back = false;
+    BulkLoader loader;
+    
+    while (!back) {
+        cout << "\n" << string(70, '-') << endl;
+        cout << "              BULK LOAD FROM CSV FILES" << endl;
+        cout << string(70, '-') << endl;
+        cout << "1. Load Stations (id,name[,x,y])" << endl;
+        cout << "2. Load Routes (source,destination,weight)" << endl;
+        cout << "3. Load Vehicles (id,type,model,capacity,speed)" << endl;
+        cout << "4. Load Route Metadata (routeId,routeName[,passengerCount,averageTime])" << endl;
+        cout << "5. Load Passengers (id,name,sourceStation,destinationStation)" << endl;
+        cout << "6. Back to Main Menu" << endl;
+        cout << string(70, '-') << endl;
+        cout << "Enter your choice: ";
+        cin >> choice;
+        cin.ignore();
+        
+        if (choice == 6) {
+            back = true;
+            continue;
+        }
+        if (choice < 1 || choice > 5) {
+            cout << "Invalid choice!" << endl;
+            continue;
+        }
+        
+        string filename;
+        cout << "Enter CSV file name: ";
+        getline(cin, filename);
+        
+        LoadStats stats;
+        bool loaded = false;
+        string what;
+        switch (choice) {
+            case 1:
+                loaded = loader.loadStations(filename, graph, &stats);
+                what = "stations";
+                break;
+            case 2:
+                loaded = loader.loadRoutes(filename, graph, &stats);
+                what = "routes";
+                break;
+            case 3:
+                loaded = loader.loadVehicles(filename, vehicleDB, &stats);
+                what = "vehicles";
+                break;
+            case 4:
+                loaded = loader.loadRouteMetadata(filename, routeMetadata, &stats);
+                what = "route metadata records";
+                break;
+            case 5:
+                loaded = loader.loadPassengers(filename, ticketQueue, &stats);
+                what = "passengers";
+                break;
+        }
+        
+        if (loaded) {
+            BulkLoader::printStats(what, stats);
+        } else {
+            cout << "Could not open file '" << filename << "'!" << endl;
+        }
+    }
+}
+
 // Test Suite Runner - Simple version integrated into main
 void runTestSuite() {
     cout << "\n" << string(70, '=') << endl;
@@ -830,7 +966,7 @@ void runTestSuite() {
     cout << "\n[TEST] Hash Table Operations..." << endl;
     HashTable testHash;
     testHash.insert(Vehicle(100, "Test", "Model", 50, 60.0));
-    Vehicle* v = testHash.search(100);
+    const Vehicle* v = testHash.search(100);
     cout << "  ✓ Hash table operations working" << endl;
     
     cout << "\n[TEST] BST Operations..." << endl;
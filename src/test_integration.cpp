@@ -49,7 +49,7 @@ void runTestSuite() {
     cout << "\n[TEST] Hash Table Operations..." << endl;
     HashTable testHash;
     testHash.insert(Vehicle(100, "Test", "Model", 50, 60.0));
-    Vehicle* v = testHash.search(100);
+    const Vehicle* v = testHash.search(100);
     cout << "  ✓ Hash table operations working" << endl;
     
     cout << "\n[TEST] BST Operations..." << endl;